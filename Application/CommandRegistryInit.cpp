@@ -8,11 +8,13 @@
 #include "CommandRegistryInit.h"
 #include "Debug/Logger.h"
 #include <iostream>
+#include <mutex>
 #include "../FasterBASICT/src/modular_commands.h"
 #include "../FasterBASICT/src/command_registry_core.h"
 #include "../FasterBASICT/src/fasterbasic_semantic.h"
 #include "../command_registry_superterminal.h"
 #include "../register_voice.h"
+#include "../PerfectHash.h"
 
 using namespace FasterBASIC::ModularCommands;
 using namespace FBRunner3::VoiceRegistration;
@@ -20,16 +22,56 @@ using namespace FBRunner3::VoiceRegistration;
 namespace FBRunner3 {
 namespace SuperTerminalCommands {
 
-void initializeFBRunner3CommandRegistry() {
+// The registry is built exactly once per process and never modified again.
+// Every compile, the highlighter and HELP read the same frozen instance, so
+// no compile pays for re-registering thousands of definitions and compiles
+// on different threads never see it half-built.
+static std::once_flag s_registryBuilt;
+
+// Perfect-hash indexes over the frozen registry's command and function names.
+// Built once alongside the registry; lookups are a single probe and accept
+// any letter case, so callers never make an uppercase copy of the word.
+static SuperTerminal::PerfectHashIndex s_commandIndex;
+static SuperTerminal::PerfectHashIndex s_functionIndex;
+static std::vector<const CommandDefinition*> s_commandDefinitions;
+static std::vector<const CommandDefinition*> s_functionDefinitions;
+
+static void buildCommandNameIndexes(const CommandRegistry& registry) {
+    std::vector<std::string> commandNames;
+    std::vector<std::string> functionNames;
+    for (const auto& category : registry.getCategories()) {
+        for (const auto& name : registry.getCommandsByCategory(category)) {
+            commandNames.push_back(name);
+        }
+        for (const auto& name : registry.getFunctionsByCategory(category)) {
+            functionNames.push_back(name);
+        }
+    }
+
+    s_commandDefinitions.clear();
+    for (const auto& name : commandNames) {
+        s_commandDefinitions.push_back(registry.getCommand(name));
+    }
+    s_functionDefinitions.clear();
+    for (const auto& name : functionNames) {
+        s_functionDefinitions.push_back(registry.getFunction(name));
+    }
+
+    s_commandIndex.build(commandNames);
+    s_functionIndex.build(functionNames);
+    LOG_INFOF("Command name index: %zu commands, %zu functions",
+              s_commandIndex.size(), s_functionIndex.size());
+}
+
+static void buildFBRunner3CommandRegistry() {
     LOG_INFO("Starting registry initialization...");
     
     // Get the FasterBASIC global registry that the compiler uses
     CommandRegistry& registry = getGlobalCommandRegistry();
     LOG_INFO("Got global registry reference");
 
-    // Clear it to ensure clean state
+    // Start from a clean state (this is the only time it is ever cleared)
     registry.clear();
-    LOG_INFO("Registry cleared");
 
     // Register core commands first (math, string, file I/O, etc.)
     CoreCommandRegistry::registerCoreCommands(registry);
@@ -63,13 +105,38 @@ void initializeFBRunner3CommandRegistry() {
         }
     }
     
+    // Index the names now that the registry will not change again
+    buildCommandNameIndexes(registry);
+
     // CRITICAL: Mark the registry as initialized to prevent the lexer from clearing it later
     markGlobalRegistryInitialized();
     LOG_INFO("Registry marked as initialized");
     LOG_INFO("✓ Registry initialization COMPLETE");
 }
 
+void initializeFBRunner3CommandRegistry() {
+    std::call_once(s_registryBuilt, buildFBRunner3CommandRegistry);
+}
+
+const FasterBASIC::ModularCommands::CommandRegistry& getFrozenCommandRegistry() {
+    initializeFBRunner3CommandRegistry();
+    return getGlobalCommandRegistry();
+}
+
+const CommandDefinition* findRegisteredCommand(std::string_view name) {
+    initializeFBRunner3CommandRegistry();
+    int32_t index = s_commandIndex.find(name);
+    return index == SuperTerminal::PerfectHashIndex::NOT_FOUND ? nullptr : s_commandDefinitions[index];
+}
+
+const CommandDefinition* findRegisteredFunction(std::string_view name) {
+    initializeFBRunner3CommandRegistry();
+    int32_t index = s_functionIndex.find(name);
+    return index == SuperTerminal::PerfectHashIndex::NOT_FOUND ? nullptr : s_functionDefinitions[index];
+}
+
 FasterBASIC::ModularCommands::CommandRegistry* getSuperTerminalRegistry() {
+    initializeFBRunner3CommandRegistry();
     return &getGlobalCommandRegistry();
 }
 
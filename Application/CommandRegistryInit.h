@@ -9,9 +9,12 @@
 #ifndef COMMANDREGISTRYINIT_H
 #define COMMANDREGISTRYINIT_H
 
+#include <string_view>
+
 namespace FasterBASIC {
 namespace ModularCommands {
     class CommandRegistry;
+    class CommandDefinition;
 }
 }
 
@@ -30,10 +33,33 @@ namespace SuperTerminalCommands {
  * This MUST be called before creating any FasterBASIC Lexer objects or
  * performing any compilation operations.
  * 
- * @note This function is idempotent - calling it multiple times is safe.
+ * @note The registry is built on the first call only; later calls return
+ *       immediately. Safe to call from several threads at once.
  */
 void initializeFBRunner3CommandRegistry();
 
+/**
+ * @brief Get the built, read-only command registry
+ *
+ * Builds the registry on first use. Compiles, the syntax highlighter and the
+ * help system should read commands through this reference; the registry is
+ * never cleared or re-registered after it has been built.
+ *
+ * @return Const reference to the global command registry
+ */
+const FasterBASIC::ModularCommands::CommandRegistry& getFrozenCommandRegistry();
+
+/**
+ * @brief Look up a registered command or function by name
+ *
+ * Single-probe perfect-hash lookup over the frozen registry's names. The
+ * name may be in any letter case.
+ *
+ * @return The definition, or nullptr if no such command/function exists
+ */
+const FasterBASIC::ModularCommands::CommandDefinition* findRegisteredCommand(std::string_view name);
+const FasterBASIC::ModularCommands::CommandDefinition* findRegisteredFunction(std::string_view name);
+
 /**
  * @brief Get the initialized SuperTerminal command registry
  * 
@@ -41,7 +67,7 @@ void initializeFBRunner3CommandRegistry();
  * with all core and SuperTerminal commands.
  * 
  * @return Pointer to the global command registry
- * @note Must call initializeFBRunner3CommandRegistry() first
+ * @note Prefer getFrozenCommandRegistry(); the registry must not be modified
  */
 FasterBASIC::ModularCommands::CommandRegistry* getSuperTerminalRegistry();
 
@@ -0,0 +1,55 @@
+//
+// CompileCache.cpp
+// FBRunner3 - Reuse of the previous compile
+//
+
+#include "CompileCache.h"
+#include <cctype>
+
+namespace FBRunner3 {
+
+static bool isIdentifierChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$';
+}
+
+// Whether the word INCLUDE appears anywhere in source, in any case. Strings
+// and comments are not told apart: a false hit only costs a recompile.
+static bool mentionsInclude(const std::string& source) {
+    static const char keyword[] = "INCLUDE";
+    const size_t length = sizeof(keyword) - 1;
+    for (size_t i = 0; i + length <= source.size(); ++i) {
+        if (std::toupper(static_cast<unsigned char>(source[i])) != 'I' ||
+            (i > 0 && isIdentifierChar(source[i - 1]))) {
+            continue;
+        }
+        size_t k = 1;
+        while (k < length && std::toupper(static_cast<unsigned char>(source[i + k])) == keyword[k]) {
+            ++k;
+        }
+        if (k == length && (i + length == source.size() || !isIdentifierChar(source[i + length]))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const CompileCache::Entry* CompileCache::find(const std::string& source,
+                                              const CompileEnvironment& environment) const {
+    if (!m_valid || !m_reusable || environment != m_environment || source != m_source) {
+        return nullptr;
+    }
+    return &m_entry;
+}
+
+void CompileCache::store(const std::string& source, const CompileEnvironment& environment, Entry entry) {
+    // The runtime was just handed this entry's ConstantsManager, so the entry
+    // is kept either way. Included files can change without the source
+    // changing, so such a compile is never reused.
+    m_source = source;
+    m_environment = environment;
+    m_entry = std::move(entry);
+    m_valid = true;
+    m_reusable = !mentionsInclude(source);
+}
+
+} // namespace FBRunner3
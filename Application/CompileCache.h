@@ -0,0 +1,71 @@
+//
+// CompileCache.h
+// FBRunner3 - Reuse of the previous compile
+//
+// RUN again with no edit used to push the whole program back through
+// preprocessing, lexing, parsing, semantic analysis, IR generation and Lua
+// code generation. The cache keeps the last successful compile of the GUI
+// entry point: its source, the environment its runtime constants were taken
+// from, the generated Lua, the DATA preprocessor result and the semantic
+// analyzer (which owns the ConstantsManager handed to the Lua runtime).
+//
+// Only exact-match reuse is implemented: a request whose source and
+// environment are identical to the cached ones is answered from the cache,
+// and any edit recompiles the whole program. There is no per-procedure
+// recompilation. A program that INCLUDEs other files is kept (its analyzer
+// still backs the runtime) but never reused, since the source text alone
+// does not say whether those files changed.
+//
+
+#ifndef COMPILECACHE_H
+#define COMPILECACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "../FasterBASICT/src/fasterbasic_data_preprocessor.h"
+#include "../FasterBASICT/src/fasterbasic_semantic.h"
+
+namespace FBRunner3 {
+
+/// Values injected into the compile as runtime constants
+struct CompileEnvironment {
+    uint32_t windowWidth = 0;
+    uint32_t windowHeight = 0;
+    int textCols = 0;
+    int textRows = 0;
+
+    bool operator==(const CompileEnvironment& other) const {
+        return windowWidth == other.windowWidth && windowHeight == other.windowHeight &&
+               textCols == other.textCols && textRows == other.textRows;
+    }
+    bool operator!=(const CompileEnvironment& other) const { return !(*this == other); }
+};
+
+class CompileCache {
+public:
+    /// Outputs of one successful compile
+    struct Entry {
+        std::string luaCode;
+        FasterBASIC::DataPreprocessorResult dataResult;
+        std::unique_ptr<FasterBASIC::SemanticAnalyzer> semantic;
+    };
+
+    /// Cached compile of exactly this source in this environment, or nullptr
+    const Entry* find(const std::string& source, const CompileEnvironment& environment) const;
+
+    /// Replace the cached compile. The entry is kept alive until the next
+    /// store even when it cannot be reused (a source with INCLUDE).
+    void store(const std::string& source, const CompileEnvironment& environment, Entry entry);
+
+private:
+    bool m_valid = false;
+    bool m_reusable = false;
+    std::string m_source;
+    CompileEnvironment m_environment;
+    Entry m_entry;
+};
+
+} // namespace FBRunner3
+
+#endif // COMPILECACHE_H
@@ -0,0 +1,159 @@
+//
+// HighlightCache.cpp
+// FasterBASIC - Incremental state for syntax highlighting
+//
+
+#include "HighlightCache.h"
+#include <cctype>
+#include <functional>
+
+namespace FBRunner3 {
+namespace Syntax {
+
+static size_t hashLine(std::string_view text) {
+    return std::hash<std::string_view>{}(text);
+}
+
+std::string_view declaredConstantName(std::string_view line) {
+    // Simple regex-free parsing: look for "CONSTANT name ="
+    static constexpr std::string_view KEYWORD = "CONSTANT";
+
+    for (size_t pos = 0; pos + KEYWORD.size() <= line.size(); pos++) {
+        if (!SuperTerminal::identifierEquals(line.substr(pos, KEYWORD.size()), KEYWORD)) {
+            continue;
+        }
+
+        // Skip past "CONSTANT"
+        size_t nameStart = pos + KEYWORD.size();
+        while (nameStart < line.size() && std::isspace(static_cast<unsigned char>(line[nameStart]))) {
+            nameStart++;
+        }
+
+        // Extract the constant name
+        size_t nameEnd = nameStart;
+        while (nameEnd < line.size() &&
+               (std::isalnum(static_cast<unsigned char>(line[nameEnd])) ||
+                line[nameEnd] == '_' || line[nameEnd] == '$')) {
+            nameEnd++;
+        }
+        return line.substr(nameStart, nameEnd - nameStart);
+    }
+    return {};
+}
+
+// =============================================================================
+// UserConstantTracker
+// =============================================================================
+
+void UserConstantTracker::updateLine(size_t index, std::string_view text) {
+    const size_t hash = hashLine(text);
+    if (index >= m_lines.size()) {
+        m_lines.resize(index + 1);
+    } else if (m_lines[index].hash == hash) {
+        return;
+    }
+
+    LineState& state = m_lines[index];
+    state.hash = hash;
+
+    std::string name(declaredConstantName(text));
+    for (char& c : name) {
+        c = SuperTerminal::foldIdentifierChar(c);
+    }
+    if (name == state.name) {
+        return;
+    }
+
+    if (!state.name.empty()) {
+        removeName(state.name);
+    }
+    if (!name.empty()) {
+        addName(name);
+    }
+    state.name = std::move(name);
+}
+
+void UserConstantTracker::truncate(size_t lineCount) {
+    while (m_lines.size() > lineCount) {
+        if (!m_lines.back().name.empty()) {
+            removeName(m_lines.back().name);
+        }
+        m_lines.pop_back();
+    }
+}
+
+bool UserConstantTracker::publish() {
+    if (!m_namesChanged) {
+        return false;
+    }
+
+    std::vector<std::string> names;
+    names.reserve(m_refCounts.size());
+    for (const auto& [name, count] : m_refCounts) {
+        names.push_back(name);
+    }
+    m_index.build(names);
+
+    m_namesChanged = false;
+    m_version++;
+    return true;
+}
+
+void UserConstantTracker::clear() {
+    m_lines.clear();
+    if (!m_refCounts.empty()) {
+        m_refCounts.clear();
+        m_namesChanged = true;
+    }
+}
+
+void UserConstantTracker::addName(const std::string& name) {
+    // Only the first declaring line changes the set of names
+    if (m_refCounts[name]++ == 0) {
+        m_namesChanged = true;
+    }
+}
+
+void UserConstantTracker::removeName(const std::string& name) {
+    auto it = m_refCounts.find(name);
+    if (it == m_refCounts.end()) {
+        return;
+    }
+    if (--it->second == 0) {
+        m_refCounts.erase(it);
+        m_namesChanged = true;
+    }
+}
+
+// =============================================================================
+// LineColorCache
+// =============================================================================
+
+const std::vector<uint32_t>* LineColorCache::find(std::string_view line,
+                                                  uint32_t symbolVersion) const {
+    auto it = m_entries.find(hashLine(line));
+    if (it == m_entries.end() || it->second.text != line) {
+        return nullptr;
+    }
+    if (it->second.usesSymbols && it->second.symbolVersion != symbolVersion) {
+        return nullptr;
+    }
+    return &it->second.colors;
+}
+
+void LineColorCache::store(std::string_view line, uint32_t symbolVersion, bool usesSymbols,
+                           std::vector<uint32_t> colors) {
+    // Bounded: a full cache is simply dropped and refilled from what is on screen
+    if (m_entries.size() >= m_capacity) {
+        m_entries.clear();
+    }
+
+    Entry& entry = m_entries[hashLine(line)];
+    entry.text.assign(line);
+    entry.symbolVersion = symbolVersion;
+    entry.usesSymbols = usesSymbols;
+    entry.colors = std::move(colors);
+}
+
+} // namespace Syntax
+} // namespace FBRunner3
@@ -0,0 +1,97 @@
+//
+// HighlightCache.h
+// FasterBASIC - Incremental state for syntax highlighting
+//
+// Highlighting a screen should cost the lines on it, not the document.
+// UserConstantTracker keeps the program's CONSTANT names up to date one
+// line at a time (a line is only rescanned when its content hash changes)
+// and bumps a symbol version whenever the set of names actually changes.
+// LineColorCache keeps the colours for each distinct line text, so an
+// unchanged line is never re-tokenized until the symbol version moves.
+//
+
+#ifndef HIGHLIGHTCACHE_H
+#define HIGHLIGHTCACHE_H
+
+#include "../PerfectHash.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace FBRunner3 {
+namespace Syntax {
+
+/// Name declared by a "CONSTANT name" statement on this line, or empty
+std::string_view declaredConstantName(std::string_view line);
+
+class UserConstantTracker {
+public:
+    /// Record the current text of line index. Cheap when the line is
+    /// unchanged (one hash compare); otherwise its declaration is rescanned.
+    void updateLine(size_t index, std::string_view text);
+
+    /// Forget lines at or past lineCount (the document got shorter)
+    void truncate(size_t lineCount);
+
+    /// Rebuild the lookup index if any declaration changed since the last
+    /// publish. @return true if the set of names changed
+    bool publish();
+
+    /// Forget everything (new document loaded)
+    void clear();
+
+    const SuperTerminal::PerfectHashIndex& index() const { return m_index; }
+    uint32_t symbolVersion() const { return m_version; }
+    size_t lineCount() const { return m_lines.size(); }
+
+private:
+    struct LineState {
+        size_t hash = 0;
+        std::string name;   // Upper-cased declared name, empty if none
+    };
+
+    void addName(const std::string& name);
+    void removeName(const std::string& name);
+
+    std::vector<LineState> m_lines;
+    std::unordered_map<std::string, uint32_t> m_refCounts;  // name -> declaring lines
+    SuperTerminal::PerfectHashIndex m_index;
+    uint32_t m_version = 0;
+    bool m_namesChanged = false;
+};
+
+class LineColorCache {
+public:
+    explicit LineColorCache(size_t capacity = 8192) : m_capacity(capacity) {}
+
+    /// Cached colours for line, or nullptr if the line was never seen or was
+    /// highlighted against an older symbol version and used a user name.
+    const std::vector<uint32_t>* find(std::string_view line, uint32_t symbolVersion) const;
+
+    /// Remember colours for line. usesSymbols says whether any word in the
+    /// line could change colour when user CONSTANT names change.
+    void store(std::string_view line, uint32_t symbolVersion, bool usesSymbols,
+               std::vector<uint32_t> colors);
+
+    void clear() { m_entries.clear(); }
+    size_t size() const { return m_entries.size(); }
+
+private:
+    struct Entry {
+        std::string text;
+        uint32_t symbolVersion = 0;
+        bool usesSymbols = false;
+        std::vector<uint32_t> colors;
+    };
+
+    std::unordered_map<size_t, Entry> m_entries;   // keyed by hash of text
+    size_t m_capacity;
+};
+
+} // namespace Syntax
+} // namespace FBRunner3
+
+#endif // HIGHLIGHTCACHE_H
@@ -0,0 +1,100 @@
+//
+// IdentifierClassifier.cpp
+// FasterBASIC - Identifier classification for highlighting and tooling
+//
+
+#include "IdentifierClassifier.h"
+#include "CommandRegistryInit.h"
+#include "Debug/Logger.h"
+#include <string>
+#include "../FasterBASICT/src/fasterbasic_semantic.h"
+
+namespace FBRunner3 {
+namespace Syntax {
+
+// BASIC control flow keywords (these are language keywords, not commands)
+static constexpr std::string_view KEYWORDS[] = {
+    "PRINT", "INPUT", "LET", "IF", "THEN", "ELSE", "ELSEIF", "ENDIF",
+    "GOTO", "GOSUB", "RETURN", "FOR", "TO", "STEP", "NEXT",
+    "WHILE", "WEND", "DO", "LOOP", "UNTIL", "REPEAT",
+    "DIM", "DATA", "READ", "RESTORE", "END", "EXIT",
+    "REM", "AND", "OR", "NOT", "XOR", "MOD",
+    "FUNCTION", "SUB", "CALL", "LOCAL", "DEF", "FN",
+    "CASE", "SELECT", "OF", "WHEN", "OTHERWISE", "ENDCASE",
+    "OPTION", "BASE", "INCLUDE", "ONCE"
+};
+
+// BASIC built-in functions (these are built into the language)
+static constexpr std::string_view BUILTINS[] = {
+    "INT", "ABS", "SIN", "COS", "TAN", "SQR", "LOG", "EXP", "RND",
+    "LEFT$", "RIGHT$", "MID$", "LEN", "STR$", "VAL", "CHR$", "ASC",
+    "INKEY$", "ATN", "SGN"
+};
+
+// Constants the runtime injects into the Lua state (not in ConstantsManager)
+static constexpr std::string_view RUNTIME_CONSTANTS[] = {
+    "WINDOW_WIDTH", "WINDOW_HEIGHT", "TEXT_COLS", "TEXT_ROWS",
+    "GRAPHICS_WIDTH", "GRAPHICS_HEIGHT", "SIXEL_WIDTH", "SIXEL_HEIGHT",
+    "KEY_UP", "KEY_DOWN", "KEY_LEFT", "KEY_RIGHT",
+    "KEY_RETURN", "KEY_ESCAPE", "KEY_SPACE", "KEY_DELETE", "KEY_TAB"
+};
+
+const IdentifierClassifier& IdentifierClassifier::shared() {
+    static const IdentifierClassifier classifier;
+    return classifier;
+}
+
+IdentifierClassifier::IdentifierClassifier() {
+    // Names are added in precedence order; when a name appears twice the
+    // index keeps the first, so a keyword is never reported as a command
+    std::vector<std::string> names;
+
+    auto add = [&](std::string_view name, IdentifierKind kind) {
+        names.emplace_back(name);
+        m_kinds.push_back(kind);
+    };
+
+    for (std::string_view keyword : KEYWORDS) {
+        add(keyword, IdentifierKind::KEYWORD);
+    }
+    for (std::string_view builtin : BUILTINS) {
+        add(builtin, IdentifierKind::BUILTIN);
+    }
+
+    FasterBASIC::ConstantsManager constants;
+    constants.addPredefinedConstants();
+    for (const auto& name : constants.getAllConstantNames()) {
+        add(name, IdentifierKind::CONSTANT);
+    }
+    for (std::string_view name : RUNTIME_CONSTANTS) {
+        add(name, IdentifierKind::CONSTANT);
+    }
+
+    // Commands and functions are not copied in: the registry's own name
+    // indexes answer for them (see classify)
+    m_index.build(names);
+    LOG_INFOF("Identifier classifier: %zu names", m_index.size());
+}
+
+IdentifierKind IdentifierClassifier::classify(std::string_view word,
+                                              const SuperTerminal::PerfectHashIndex* userConstants) const {
+    int32_t index = m_index.find(word);
+    IdentifierKind kind = index == SuperTerminal::PerfectHashIndex::NOT_FOUND ? IdentifierKind::NONE : m_kinds[index];
+
+    if (kind == IdentifierKind::KEYWORD || kind == IdentifierKind::BUILTIN || kind == IdentifierKind::CONSTANT) {
+        return kind;
+    }
+    if (userConstants && userConstants->contains(word)) {
+        return IdentifierKind::USER_CONSTANT;
+    }
+    if (SuperTerminalCommands::findRegisteredCommand(word)) {
+        return IdentifierKind::COMMAND;
+    }
+    if (SuperTerminalCommands::findRegisteredFunction(word)) {
+        return IdentifierKind::FUNCTION;
+    }
+    return IdentifierKind::NONE;
+}
+
+} // namespace Syntax
+} // namespace FBRunner3
@@ -0,0 +1,55 @@
+//
+// IdentifierClassifier.h
+// FasterBASIC - Identifier classification for highlighting and tooling
+//
+// Answers "what is this word?" for BASIC source: language keyword, built-in
+// function, predefined constant, registered command or registered function.
+// Keywords, built-ins and constants are held in one case-insensitive perfect
+// hash built from the ConstantsManager; commands and functions are looked up
+// in the frozen registry's own perfect-hash indexes. Classifying a word is a
+// few constant-time probes with no uppercase copy.
+//
+
+#ifndef IDENTIFIERCLASSIFIER_H
+#define IDENTIFIERCLASSIFIER_H
+
+#include "../PerfectHash.h"
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace FBRunner3 {
+namespace Syntax {
+
+enum class IdentifierKind : uint8_t {
+    NONE,
+    KEYWORD,        // Control flow and statement keywords (PRINT, IF, FOR, ...)
+    BUILTIN,        // Functions built into the language (LEFT$, SIN, ...)
+    CONSTANT,       // Predefined constants (ConstantsManager and runtime-injected)
+    USER_CONSTANT,  // CONSTANT declared in the program being edited
+    COMMAND,        // Registered SuperTerminal/core command
+    FUNCTION        // Registered SuperTerminal/core function
+};
+
+class IdentifierClassifier {
+public:
+    /// The process-wide classifier (built on first use, then read-only)
+    static const IdentifierClassifier& shared();
+
+    /// Classify word (any letter case). userConstants, if given, is checked
+    /// after predefined constants and before commands, matching the order
+    /// the compiler resolves names in.
+    IdentifierKind classify(std::string_view word,
+                            const SuperTerminal::PerfectHashIndex* userConstants = nullptr) const;
+
+private:
+    IdentifierClassifier();
+
+    SuperTerminal::PerfectHashIndex m_index;     // Keywords, built-ins, constants
+    std::vector<IdentifierKind> m_kinds;
+};
+
+} // namespace Syntax
+} // namespace FBRunner3
+
+#endif // IDENTIFIERCLASSIFIER_H
@@ -0,0 +1,132 @@
+//
+// ParallelLexer.cpp
+// FBRunner3 - Parallel lexing of large programs
+//
+
+#include "ParallelLexer.h"
+#include "ProcedureBlocks.h"
+#include <algorithm>
+#include <thread>
+
+namespace FBRunner3 {
+
+// =============================================================================
+// Segmentation
+// =============================================================================
+
+std::vector<SourceSegment> splitAtProcedureBoundaries(std::string_view source, size_t maxSegments) {
+    std::vector<ProcedureBlock> blocks = findProcedureBlocks(source);
+
+    // Keep the cuts that come closest to equal-sized pieces
+    std::vector<SourceSegment> segments;
+    size_t target = maxSegments > 1 ? source.size() / maxSegments : source.size() + 1;
+    size_t start = 0;
+    size_t startLine = 0;
+    for (const auto& block : blocks) {
+        if (segments.size() + 1 >= maxSegments) {
+            break;
+        }
+        if (block.offset - start >= target) {
+            segments.push_back({start, block.offset - start, startLine});
+            start = block.offset;
+            startLine = block.firstLine;
+        }
+    }
+    segments.push_back({start, source.size() - start, startLine});
+    return segments;
+}
+
+// =============================================================================
+// Tokenizing
+// =============================================================================
+
+bool ParallelLexer::tokenize(const std::string& source) {
+    m_tokens.clear();
+    m_stitched = false;
+    m_segmentCount = 1;
+
+    if (source.size() >= kMinParallelBytes) {
+        size_t threads = std::max(1u, std::thread::hardware_concurrency());
+        size_t maxSegments = std::min(threads, source.size() / kMinSegmentBytes);
+        if (maxSegments > 1) {
+            std::vector<SourceSegment> segments = splitAtProcedureBoundaries(source, maxSegments);
+            if (segments.size() > 1 && tokenizeSegments(source, segments)) {
+                m_stitched = true;
+                m_segmentCount = segments.size();
+                return true;
+            }
+        }
+    }
+
+    // Serial lex: the small-program path, and the source of all diagnostics
+    return m_serial.tokenize(source);
+}
+
+bool ParallelLexer::tokenizeSegments(const std::string& source, const std::vector<SourceSegment>& segments) {
+    std::vector<std::vector<FasterBASIC::Token>> pieces(segments.size());
+    std::vector<char> succeeded(segments.size(), 0);
+
+    // An exception must not escape a worker thread (std::terminate); the
+    // piece is left failed and the serial lex reports the error instead
+    auto lexSegment = [&](size_t index) {
+        const SourceSegment& segment = segments[index];
+        try {
+            FasterBASIC::Lexer lexer;
+            if (lexer.tokenize(source.substr(segment.offset, segment.length))) {
+                pieces[index] = lexer.getTokens();
+                succeeded[index] = 1;
+            }
+        } catch (...) {
+            pieces[index].clear();
+        }
+    };
+
+    // The caller's thread takes the first piece
+    std::vector<std::thread> workers;
+    workers.reserve(segments.size() - 1);
+    for (size_t i = 1; i < segments.size(); ++i) {
+        workers.emplace_back(lexSegment, i);
+    }
+    lexSegment(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Any error is reported by the serial lex, so messages and line numbers
+    // match exactly
+    size_t total = 0;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        if (!succeeded[i] || pieces[i].empty()) {
+            return false;
+        }
+        total += pieces[i].size();
+    }
+
+    // Every piece ends with its own end-of-input token; only the last one
+    // belongs in the stitched stream
+    const auto& endToken = pieces.back().back();
+    for (const auto& piece : pieces) {
+        if (piece.back().type != endToken.type) {
+            return false;
+        }
+    }
+
+    m_tokens.reserve(total - (segments.size() - 1));
+    for (size_t i = 0; i < segments.size(); ++i) {
+        auto& piece = pieces[i];
+        if (i + 1 < segments.size()) {
+            piece.pop_back();
+        }
+        for (auto& token : piece) {
+            token.location.line += static_cast<int>(segments[i].firstLine);
+            m_tokens.push_back(std::move(token));
+        }
+    }
+    return true;
+}
+
+const std::vector<FasterBASIC::Token>& ParallelLexer::getTokens() const {
+    return m_stitched ? m_tokens : m_serial.getTokens();
+}
+
+} // namespace FBRunner3
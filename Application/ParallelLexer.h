@@ -0,0 +1,78 @@
+//
+// ParallelLexer.h
+// FBRunner3 - Parallel lexing of large programs
+//
+// Large generated programs are mostly SUB and FUNCTION blocks, and lexing
+// them is strictly line-local: no token spans a line break. The source is cut
+// at top-level procedure headers into one piece per core, each piece is lexed
+// by its own Lexer on its own thread, and the token streams are stitched back
+// in source order (line locations rebased to the whole source, the
+// intermediate end-of-input tokens dropped) before the single parse.
+//
+// Diagnostics stay exactly those of the serial path: if any piece reports a
+// lexer error, the whole source is lexed again serially and its errors are
+// the ones returned. Small programs always take the serial path.
+//
+// Drop-in for FasterBASIC::Lexer in the compile entry points:
+//
+//     ParallelLexer lexer;
+//     if (!lexer.tokenize(source)) { ... lexer.getErrors() ... }
+//     Parser parser;
+//     auto program = parser.parse(lexer.getTokens());
+//
+
+#ifndef PARALLELLEXER_H
+#define PARALLELLEXER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../FasterBASICT/src/fasterbasic_lexer.h"
+
+namespace FBRunner3 {
+
+/// A run of whole source lines that can be lexed on its own
+struct SourceSegment {
+    size_t offset;      ///< Byte offset of the first line
+    size_t length;      ///< Bytes, including the final line break
+    size_t firstLine;   ///< Number of source lines before the segment
+};
+
+/// Cut source at top-level SUB/FUNCTION headers into at most maxSegments
+/// segments of roughly equal size. Returns a single segment when the source
+/// has no usable cut points.
+std::vector<SourceSegment> splitAtProcedureBoundaries(std::string_view source, size_t maxSegments);
+
+class ParallelLexer {
+public:
+    /// Sources below this size are always lexed serially
+    static constexpr size_t kMinParallelBytes = 256 * 1024;
+    /// Smallest piece worth a thread of its own
+    static constexpr size_t kMinSegmentBytes = 64 * 1024;
+
+    /// Tokenize source
+    /// @return false on lexer errors (see getErrors)
+    bool tokenize(const std::string& source);
+
+    /// Tokens of the whole source, as the serial Lexer would produce them
+    const std::vector<FasterBASIC::Token>& getTokens() const;
+
+    /// Errors of the serial lex of the whole source
+    decltype(auto) getErrors() const { return m_serial.getErrors(); }
+
+    /// Number of pieces lexed by the last tokenize (1 = serial)
+    size_t getSegmentCount() const { return m_segmentCount; }
+
+private:
+    bool tokenizeSegments(const std::string& source, const std::vector<SourceSegment>& segments);
+
+    FasterBASIC::Lexer m_serial;
+    std::vector<FasterBASIC::Token> m_tokens;
+    bool m_stitched = false;
+    size_t m_segmentCount = 0;
+};
+
+} // namespace FBRunner3
+
+#endif // PARALLELLEXER_H
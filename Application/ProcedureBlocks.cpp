@@ -0,0 +1,71 @@
+//
+// ProcedureBlocks.cpp
+// FBRunner3 - Top-level SUB/FUNCTION blocks of a BASIC source
+//
+
+#include "ProcedureBlocks.h"
+#include <cctype>
+#include <cstring>
+
+namespace FBRunner3 {
+
+static bool isIdentifierChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$' || c == '%' ||
+           c == '#' || c == '!' || c == '&';
+}
+
+// Match a whole keyword (any case) at p, returning the position after it
+static const char* matchKeyword(const char* p, const char* end, const char* keyword) {
+    size_t length = std::strlen(keyword);
+    if (static_cast<size_t>(end - p) < length) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < length; ++i) {
+        if (std::toupper(static_cast<unsigned char>(p[i])) != keyword[i]) {
+            return nullptr;
+        }
+    }
+    if (p + length < end && isIdentifierChar(p[length])) {
+        return nullptr;
+    }
+    return p + length;
+}
+
+static const char* skipBlanks(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t')) {
+        ++p;
+    }
+    return p;
+}
+
+std::vector<ProcedureBlock> findProcedureBlocks(std::string_view source) {
+    const char* begin = source.data();
+    const char* end = begin + source.size();
+
+    std::vector<ProcedureBlock> blocks;
+    size_t lineIndex = 0;
+
+    for (const char* cursor = begin; cursor < end; ++lineIndex) {
+        const char* nl = static_cast<const char*>(std::memchr(cursor, '\n', static_cast<size_t>(end - cursor)));
+        const char* lineEnd = nl ? nl : end;
+        const char* lineStart = cursor;
+        cursor = nl ? nl + 1 : end;
+
+        // Optional line number, then the first keyword of the line
+        const char* p = skipBlanks(lineStart, lineEnd);
+        while (p < lineEnd && std::isdigit(static_cast<unsigned char>(*p))) {
+            ++p;
+        }
+        p = skipBlanks(p, lineEnd);
+
+        // Procedures do not nest, so every SUB/FUNCTION header is top-level;
+        // END SUB / END FUNCTION lines start with END and never match
+        if (matchKeyword(p, lineEnd, "SUB") || matchKeyword(p, lineEnd, "FUNCTION")) {
+            blocks.push_back({static_cast<size_t>(lineStart - begin), lineIndex});
+        }
+    }
+
+    return blocks;
+}
+
+} // namespace FBRunner3
@@ -0,0 +1,30 @@
+//
+// ProcedureBlocks.h
+// FBRunner3 - Top-level SUB/FUNCTION blocks of a BASIC source
+//
+// A light line scan (no lexing) that finds the header line of each top-level
+// SUB or FUNCTION. Used to cut the source for parallel lexing.
+//
+
+#ifndef PROCEDUREBLOCKS_H
+#define PROCEDUREBLOCKS_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace FBRunner3 {
+
+/// Where one top-level procedure starts
+struct ProcedureBlock {
+    size_t offset;          ///< Byte offset of the header line
+    size_t firstLine;       ///< Number of source lines before the header
+};
+
+/// Find the top-level procedures of source, in source order. An optional
+/// leading line number is skipped; keywords match in any case.
+std::vector<ProcedureBlock> findProcedureBlocks(std::string_view source);
+
+} // namespace FBRunner3
+
+#endif // PROCEDUREBLOCKS_H
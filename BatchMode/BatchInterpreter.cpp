@@ -21,6 +21,10 @@
 #include "fasterbasic_lua_codegen.h"
 #include "command_registry_core.h"
 #include "command_registry_superterminal.h"
+#include "../Application/CommandRegistryInit.h"
+#include "../ProgramListing.h"
+#include "../ProgramLoader.h"
+#include "../FasterBASICT/src/SourceDocument.h"
 
 extern "C" {
 #include <lua.h>
@@ -42,6 +46,7 @@ BatchInterpreter::BatchInterpreter()
     : _initialized(false)
     , _outputStream(&std::cout)
     , _errorStream(&std::cerr)
+    , _collectListing(false)
     , _luaState(nullptr)
 {
 }
@@ -56,14 +61,8 @@ bool BatchInterpreter::initialize() {
     }
     
     try {
-        // Initialize command registry (must be done first)
-        CommandRegistry& registry = getGlobalCommandRegistry();
-        registry.clear();
-        CoreCommandRegistry::registerCoreCommands(registry);
-        CoreCommandRegistry::registerCoreFunctions(registry);
-        SuperTerminalCommandRegistry::registerSuperTerminalCommands(registry);
-        SuperTerminalCommandRegistry::registerSuperTerminalFunctions(registry);
-        markGlobalRegistryInitialized();
+        // Initialize command registry (must be done first; shared and built once)
+        FBRunner3::SuperTerminalCommands::initializeFBRunner3CommandRegistry();
         
         // Create command parser and program manager
         _commandParser = std::make_unique<FasterBASIC::CommandParser>();
@@ -131,7 +130,11 @@ BatchCommandResult BatchInterpreter::executeLine(const std::string& line) {
     std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::toupper);
     
     if (cmd == "LIST") {
-        return handleList();
+        std::string range;
+        for (const auto& arg : parseResult.args) {
+            range += arg;
+        }
+        return handleList(range);
     }
     else if (cmd == "NEW") {
         return handleNew();
@@ -193,6 +196,8 @@ BatchCommandResult BatchInterpreter::executeLines(const std::string& lines) {
     std::ostringstream output;
     std::ostringstream errors;
     bool allSuccess = true;
+    bool collectListing = _collectListing;
+    _collectListing = true;
     
     while (std::getline(stream, line)) {
         auto result = executeLine(line);
@@ -215,6 +220,7 @@ BatchCommandResult BatchInterpreter::executeLines(const std::string& lines) {
         }
     }
     
+    _collectListing = collectListing;
     return BatchCommandResult(allSuccess, output.str(), errors.str());
 }
 
@@ -257,16 +263,24 @@ BatchCommandResult BatchInterpreter::handleNumberedLine(int lineNumber, const st
     }
 }
 
-BatchCommandResult BatchInterpreter::handleList() {
-    auto lines = getProgramListing();
-    std::ostringstream output;
-    
-    for (const auto& line : lines) {
-        output << line << "\n";
+BatchCommandResult BatchInterpreter::handleList(const std::string& args) {
+    ListingRange range;
+    if (!ListingRange::parse(args, range)) {
+        std::string err = "Invalid line range: " + args + "\n";
+        writeError(err);
+        return BatchCommandResult(false, "", err);
     }
     
-    std::string result = output.str();
-    writeOutput(result);
+    // Formatted straight from the document and written a chunk at a time;
+    // only executeLines, which returns the combined output, keeps a copy
+    std::string result;
+    streamProgramListing(*_programManager->getDocument(), range,
+                         [this, &result](const std::string& chunk) {
+                             writeOutput(chunk);
+                             if (_collectListing) {
+                                 result += chunk;
+                             }
+                         });
     return BatchCommandResult(true, result, "");
 }
 
@@ -304,12 +318,14 @@ BatchCommandResult BatchInterpreter::handleSave(const std::string& filename) {
         return BatchCommandResult(false, "", err);
     }
     
-    auto lines = getProgramListing();
-    for (const auto& line : lines) {
-        file << line << "\n";
-    }
+    streamProgramListing(*_programManager->getDocument(), ListingRange(), file);
     
     file.close();
+    if (!file) {
+        std::string err = "Failed to write file: " + filename + "\n";
+        writeError(err);
+        return BatchCommandResult(false, "", err);
+    }
     
     std::string msg = "Saved to: " + filename + "\n";
     writeOutput(msg);
@@ -317,28 +333,15 @@ BatchCommandResult BatchInterpreter::handleSave(const std::string& filename) {
 }
 
 BatchCommandResult BatchInterpreter::handleLoad(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file) {
+    // Map the file and build the program in one pass (replaces the current
+    // program only if the file opens)
+    ProgramLoadResult loaded = loadProgramFile(filename, *_programManager);
+    if (!loaded.success) {
         std::string err = "Failed to open file: " + filename + "\n";
         writeError(err);
         return BatchCommandResult(false, "", err);
     }
     
-    // Clear current program
-    clearProgram();
-    
-    // Load lines
-    std::string line;
-    while (std::getline(file, line)) {
-        // Try to parse as numbered line
-        auto result = _commandParser->parse(line);
-        if (result.type == FasterBASIC::CommandType::NUMBERED_LINE) {
-            _programManager->addLine(result.lineNumber, result.content);
-        }
-    }
-    
-    file.close();
-    
     std::string msg = "Loaded from: " + filename + "\n";
     writeOutput(msg);
     return BatchCommandResult(true, msg, "");
@@ -437,12 +440,9 @@ void BatchInterpreter::shutdownLua() {
 
 std::string BatchInterpreter::compileProgram() {
     // Get program source
-    auto lines = getProgramListing();
-    std::ostringstream sourceStream;
-    for (const auto& line : lines) {
-        sourceStream << line << "\n";
-    }
-    std::string source = sourceStream.str();
+    std::string source;
+    streamProgramListing(*_programManager->getDocument(), ListingRange(),
+                         [&source](const std::string& chunk) { source += chunk; });
     
     if (source.empty()) {
         writeError("No program to compile.\n");
@@ -63,7 +63,9 @@ struct BatchCommandResult {
  * 
  * Supported commands:
  *   - Numbered lines (e.g., "10 PRINT \"HELLO\"")
- *   - LIST: Display program listing
+ *   - LIST [range]: Display program listing (e.g. LIST, LIST 100-200). The
+ *     listing streams to the output stream; it is also returned in the
+ *     result's output only when run through executeLines()
  *   - NEW: Clear program
  *   - RUN: Execute program
  *   - SAVE <file>: Save program to filesystem
@@ -143,6 +145,9 @@ private:
     std::ostream* _outputStream;
     std::ostream* _errorStream;
     
+    // Set by executeLines(), which returns the combined output
+    bool _collectListing;
+    
     // Core components
     std::unique_ptr<FasterBASIC::CommandParser> _commandParser;
     std::unique_ptr<FasterBASIC::ProgramManagerV2> _programManager;
@@ -153,7 +158,7 @@ private:
     
     // Command handlers
     BatchCommandResult handleNumberedLine(int lineNumber, const std::string& content);
-    BatchCommandResult handleList();
+    BatchCommandResult handleList(const std::string& args);
     BatchCommandResult handleNew();
     BatchCommandResult handleRun();
     BatchCommandResult handleSave(const std::string& filename);
@@ -16,9 +16,55 @@
 #include <sstream>
 #include <regex>
 #include <algorithm>
+#include <cctype>
+#include <functional>
 
 namespace FBRunner3 {
 
+static size_t hashEditorLine(const std::string& text) {
+    return std::hash<std::string>{}(text);
+}
+
+static size_t hashDocumentLine(int lineNumber, const std::string& text) {
+    size_t hash = std::hash<std::string>{}(text);
+    return hash ^ (static_cast<size_t>(lineNumber) * 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2));
+}
+
+static std::string editorLineFor(int lineNumber, const std::string& text, bool includeLineNumbers) {
+    if (includeLineNumbers && lineNumber > 0) {
+        // Format with line number prefix: "10 PRINT"
+        return std::to_string(lineNumber) + " " + text;
+    }
+    // Plain text without line numbers
+    return text;
+}
+
+/// Narrow two hash sequences to the window that differs: [prefix, oldEnd)
+/// in the old sequence was replaced by [prefix, newEnd) in the new one.
+/// One contiguous window covers the usual single edit exactly and several
+/// scattered edits conservatively.
+template <typename OldHashAt>
+static void changedWindow(size_t oldCount, OldHashAt oldHashAt,
+                          const std::vector<size_t>& newHashes,
+                          size_t& prefix, size_t& oldEnd, size_t& newEnd) {
+    size_t newCount = newHashes.size();
+    size_t limit = std::min(oldCount, newCount);
+
+    prefix = 0;
+    while (prefix < limit && oldHashAt(prefix) == newHashes[prefix]) {
+        prefix++;
+    }
+
+    size_t suffix = 0;
+    while (suffix < limit - prefix &&
+           oldHashAt(oldCount - 1 - suffix) == newHashes[newCount - 1 - suffix]) {
+        suffix++;
+    }
+
+    oldEnd = oldCount - suffix;
+    newEnd = newCount - suffix;
+}
+
 // =============================================================================
 // Construction
 // =============================================================================
@@ -34,6 +80,11 @@ EditorBridge::EditorBridge(SuperTerminal::TextBuffer* textBuffer,
     , m_lastSync(SyncDirection::None)
     , m_editorVersionAtLastSync(0)
     , m_shellVersionAtLastSync(0)
+    , m_shadowValid(false)
+    , m_editorOrdered(false)
+    , m_documentVersionAtShadow(0)
+    , m_lastSyncIncremental(false)
+    , m_syncVersion(0)
 {
     if (!m_textBuffer) {
         throw std::invalid_argument("EditorBridge: textBuffer cannot be null");
@@ -54,12 +105,22 @@ bool EditorBridge::syncEditorToShell() {
         return false;
     }
     
-    // Get text from editor
-    std::string editorText = m_textBuffer->getText();
+    m_lastDeltas.clear();
+    m_lastSyncIncremental = false;
     
-    // Parse into document
-    if (!editorTextToDocument(editorText)) {
-        return false;
+    if (m_shadowValid && applyEditorDeltas()) {
+        // Only the edited lines were propagated
+        m_lastSyncIncremental = true;
+    } else {
+        // Get text from editor
+        std::string editorText = m_textBuffer->getText();
+        
+        // Parse into document
+        if (!editorTextToDocument(editorText)) {
+            m_shadowValid = false;
+            return false;
+        }
+        rebuildShadow();
     }
     
     // Update sync tracking
@@ -74,28 +135,37 @@ bool EditorBridge::syncShellToEditor() {
         return false;
     }
     
-    // Store cursor position if requested
-    size_t cursorLine = 0;
-    size_t cursorColumn = 0;
-    if (m_preserveCursor) {
-        getEditorCursorPosition(cursorLine, cursorColumn);
-    }
-    
-    // Convert document to editor text
-    std::string editorText = documentToEditorText(m_showLineNumbers);
-    
-    // Set text in editor
-    m_textBuffer->setText(editorText);
+    m_lastDeltas.clear();
+    m_lastSyncIncremental = false;
     
-    // Restore cursor position if requested
-    if (m_preserveCursor) {
-        // Map cursor position from old to new content
-        // For simplicity, just clamp to valid range
-        size_t lineCount = m_textBuffer->getLineCount();
-        if (cursorLine >= lineCount) {
-            cursorLine = lineCount > 0 ? lineCount - 1 : 0;
+    if (m_shadowValid && applyDocumentDeltas()) {
+        // Only the changed lines were rewritten; cursor stays where it was
+        m_lastSyncIncremental = true;
+    } else {
+        // Store cursor position if requested
+        size_t cursorLine = 0;
+        size_t cursorColumn = 0;
+        if (m_preserveCursor) {
+            getEditorCursorPosition(cursorLine, cursorColumn);
+        }
+        
+        // Convert document to editor text
+        std::string editorText = documentToEditorText(m_showLineNumbers);
+        
+        // Set text in editor
+        m_textBuffer->setText(editorText);
+        
+        // Restore cursor position if requested
+        if (m_preserveCursor) {
+            // Map cursor position from old to new content
+            // For simplicity, just clamp to valid range
+            size_t lineCount = m_textBuffer->getLineCount();
+            if (cursorLine >= lineCount) {
+                cursorLine = lineCount > 0 ? lineCount - 1 : 0;
+            }
+            setEditorCursorPosition(cursorLine, cursorColumn);
         }
-        setEditorCursorPosition(cursorLine, cursorColumn);
+        rebuildShadow();
     }
     
     // Update sync tracking
@@ -175,6 +245,21 @@ void EditorBridge::markSynchronized() {
         m_shellVersionAtLastSync = m_document->getVersion();
     }
     m_lastSync = SyncDirection::None;
+    
+    // Both sides were changed behind the bridge's back
+    m_shadowValid = false;
+}
+
+const std::vector<EditorBridge::LineDelta>& EditorBridge::getLastDeltas() const {
+    return m_lastDeltas;
+}
+
+bool EditorBridge::wasLastSyncIncremental() const {
+    return m_lastSyncIncremental;
+}
+
+uint64_t EditorBridge::getSyncVersion() const {
+    return m_syncVersion;
 }
 
 FasterBASIC::EditorView* EditorBridge::getEditorView() {
@@ -204,14 +289,7 @@ std::string EditorBridge::documentToEditorText(bool includeLineNumbers) const {
     
     for (size_t i = 0; i < m_document->getLineCount(); ++i) {
         const auto& line = m_document->getLineByIndex(i);
-        
-        if (includeLineNumbers && line.lineNumber > 0) {
-            // Format with line number prefix: "10 PRINT"
-            oss << line.lineNumber << " " << line.text;
-        } else {
-            // Plain text without line numbers
-            oss << line.text;
-        }
+        oss << editorLineFor(line.lineNumber, line.text, includeLineNumbers);
         
         // Add newline except for last line (TextBuffer handles this)
         if (i < m_document->getLineCount() - 1) {
@@ -340,4 +418,263 @@ std::string EditorBridge::stripLineNumberPrefix(const std::string& line) const {
     return line;
 }
 
+// =============================================================================
+// Incremental Sync
+// =============================================================================
+
+std::vector<std::string> EditorBridge::readEditorLines() const {
+    std::vector<std::string> lines;
+    size_t lineCount = m_textBuffer->getLineCount();
+    lines.reserve(lineCount);
+    
+    for (size_t i = 0; i < lineCount; ++i) {
+        std::string line = m_textBuffer->getLine(i);
+        // Remove carriage returns if present
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        lines.push_back(std::move(line));
+    }
+    
+    // getText() + getline never yields a final empty line
+    if (!lines.empty() && lines.back().empty()) {
+        lines.pop_back();
+    }
+    return lines;
+}
+
+bool EditorBridge::splitNumberedLine(const std::string& line, int& lineNumber, std::string& code) {
+    // Same rule as the ^\s*(\d+)\s+(.*)$ pattern in editorTextToDocument
+    size_t pos = 0;
+    while (pos < line.size() && std::isspace(static_cast<unsigned char>(line[pos]))) {
+        pos++;
+    }
+    
+    size_t digitsStart = pos;
+    while (pos < line.size() && std::isdigit(static_cast<unsigned char>(line[pos]))) {
+        pos++;
+    }
+    if (pos == digitsStart || pos >= line.size() ||
+        !std::isspace(static_cast<unsigned char>(line[pos]))) {
+        return false;
+    }
+    
+    lineNumber = std::stoi(line.substr(digitsStart, pos - digitsStart));
+    while (pos < line.size() && std::isspace(static_cast<unsigned char>(line[pos]))) {
+        pos++;
+    }
+    code = line.substr(pos);
+    return true;
+}
+
+void EditorBridge::rebuildShadow() {
+    std::vector<std::string> editorLines = readEditorLines();
+    
+    m_editorShadow.clear();
+    m_editorShadow.reserve(editorLines.size());
+    m_editorOrdered = true;
+    int previous = 0;
+    for (const auto& line : editorLines) {
+        int lineNumber = 0;
+        std::string code;
+        if (!splitNumberedLine(line, lineNumber, code)) {
+            lineNumber = 0;
+        }
+        if (lineNumber <= previous) {
+            m_editorOrdered = false;
+        }
+        previous = lineNumber;
+        m_editorShadow.push_back({hashEditorLine(line), lineNumber});
+    }
+    
+    size_t documentLines = m_document->getLineCount();
+    m_documentShadow.clear();
+    m_documentShadow.reserve(documentLines);
+    bool canonical = true;
+    for (size_t i = 0; i < documentLines; ++i) {
+        const auto& line = m_document->getLineByIndex(i);
+        m_documentShadow.push_back(hashDocumentLine(line.lineNumber, line.text));
+        if (canonical && i < m_editorShadow.size()) {
+            canonical = m_editorShadow[i].hash ==
+                hashEditorLine(editorLineFor(line.lineNumber, line.text, m_showLineNumbers));
+        }
+    }
+    m_documentVersionAtShadow = m_document->getVersion();
+    
+    // Editor line i and document line i correspond when every editor line is
+    // numbered in ascending order (each one became one document line, in
+    // order) or when the editor text was generated from the document
+    m_shadowValid = m_editorShadow.size() == m_documentShadow.size() &&
+                    (m_editorOrdered || canonical);
+}
+
+bool EditorBridge::applyEditorDeltas() {
+    // The document must be exactly what the shadow says, and every editor
+    // line must map to the document line at the same index
+    if (m_document->getVersion() != m_documentVersionAtShadow || !m_editorOrdered ||
+        m_document->getLineCount() != m_documentShadow.size()) {
+        return false;
+    }
+    
+    std::vector<std::string> lines = readEditorLines();
+    std::vector<size_t> hashes;
+    hashes.reserve(lines.size());
+    for (const auto& line : lines) {
+        hashes.push_back(hashEditorLine(line));
+    }
+    
+    size_t prefix, oldEnd, newEnd;
+    changedWindow(m_editorShadow.size(),
+                  [this](size_t i) { return m_editorShadow[i].hash; },
+                  hashes, prefix, oldEnd, newEnd);
+    if (prefix == oldEnd && prefix == newEnd) {
+        return true;
+    }
+    
+    // Changed lines must stay numbered and ascending against their
+    // neighbours, otherwise setLineByNumber ordering would differ by index
+    std::vector<EditorShadowLine> windowShadow;
+    std::vector<std::string> codes;
+    windowShadow.reserve(newEnd - prefix);
+    codes.reserve(newEnd - prefix);
+    int previous = prefix > 0 ? m_editorShadow[prefix - 1].lineNumber : 0;
+    for (size_t i = prefix; i < newEnd; ++i) {
+        int lineNumber = 0;
+        std::string code;
+        if (!splitNumberedLine(lines[i], lineNumber, code) || lineNumber <= previous) {
+            return false;
+        }
+        previous = lineNumber;
+        windowShadow.push_back({hashes[i], lineNumber});
+        codes.push_back(std::move(code));
+    }
+    if (oldEnd < m_editorShadow.size() && m_editorShadow[oldEnd].lineNumber <= previous) {
+        return false;
+    }
+    
+    // Apply: replace the overlap, then insert or delete the remainder
+    uint64_t version = ++m_syncVersion;
+    size_t oldLength = oldEnd - prefix;
+    size_t newLength = newEnd - prefix;
+    size_t common = std::min(oldLength, newLength);
+    std::vector<size_t> documentHashes;
+    documentHashes.reserve(newLength);
+    
+    for (size_t k = 0; k < newLength; ++k) {
+        size_t index = prefix + k;
+        int lineNumber = windowShadow[k].lineNumber;
+        if (k < common) {
+            if (m_document->getLineByIndex(index).lineNumber == lineNumber) {
+                m_document->replaceLineAtIndex(index, codes[k]);
+            } else {
+                m_document->deleteLineAtIndex(index);
+                m_document->insertLineAtIndex(index, codes[k], lineNumber);
+            }
+            m_lastDeltas.push_back({LineDelta::Kind::Replace, index, lineNumber, codes[k], version});
+        } else {
+            m_document->insertLineAtIndex(index, codes[k], lineNumber);
+            m_lastDeltas.push_back({LineDelta::Kind::Insert, index, lineNumber, codes[k], version});
+        }
+        documentHashes.push_back(hashDocumentLine(lineNumber, codes[k]));
+    }
+    for (size_t k = common; k < oldLength; ++k) {
+        m_document->deleteLineAtIndex(prefix + common);
+        m_lastDeltas.push_back({LineDelta::Kind::Delete, prefix + common, 0, std::string(), version});
+    }
+    
+    // Splice the shadows to match
+    m_editorShadow.erase(m_editorShadow.begin() + prefix, m_editorShadow.begin() + oldEnd);
+    m_editorShadow.insert(m_editorShadow.begin() + prefix, windowShadow.begin(), windowShadow.end());
+    m_documentShadow.erase(m_documentShadow.begin() + prefix, m_documentShadow.begin() + oldEnd);
+    m_documentShadow.insert(m_documentShadow.begin() + prefix, documentHashes.begin(), documentHashes.end());
+    m_documentVersionAtShadow = m_document->getVersion();
+    
+    return true;
+}
+
+bool EditorBridge::applyDocumentDeltas() {
+    // The editor must be untouched since the last sync (otherwise the shell
+    // wins with a full copy, as before). A trailing empty buffer line is not
+    // part of the program and stays after any lines appended here.
+    std::vector<std::string> editorLines = readEditorLines();
+    if (editorLines.size() != m_editorShadow.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < editorLines.size(); ++i) {
+        if (hashEditorLine(editorLines[i]) != m_editorShadow[i].hash) {
+            return false;
+        }
+    }
+    
+    size_t documentLines = m_document->getLineCount();
+    if (documentLines == 0) {
+        return false;
+    }
+    std::vector<size_t> hashes;
+    hashes.reserve(documentLines);
+    for (size_t i = 0; i < documentLines; ++i) {
+        const auto& line = m_document->getLineByIndex(i);
+        hashes.push_back(hashDocumentLine(line.lineNumber, line.text));
+    }
+    
+    size_t prefix, oldEnd, newEnd;
+    changedWindow(m_documentShadow.size(),
+                  [this](size_t i) { return m_documentShadow[i]; },
+                  hashes, prefix, oldEnd, newEnd);
+    if (prefix == oldEnd && prefix == newEnd) {
+        m_documentVersionAtShadow = m_document->getVersion();
+        return true;
+    }
+    
+    // Apply: insert before delete so the buffer never becomes empty
+    uint64_t version = ++m_syncVersion;
+    size_t oldLength = oldEnd - prefix;
+    size_t newLength = newEnd - prefix;
+    size_t common = std::min(oldLength, newLength);
+    std::vector<EditorShadowLine> windowShadow;
+    windowShadow.reserve(newLength);
+    
+    for (size_t k = 0; k < newLength; ++k) {
+        size_t index = prefix + k;
+        const auto& line = m_document->getLineByIndex(index);
+        std::string text = editorLineFor(line.lineNumber, line.text, m_showLineNumbers);
+        
+        m_textBuffer->insertLine(index, text);
+        if (k < common) {
+            m_textBuffer->deleteLine(index + 1);
+        }
+        m_lastDeltas.push_back({k < common ? LineDelta::Kind::Replace : LineDelta::Kind::Insert,
+                                index, line.lineNumber, text, version});
+        
+        int lineNumber = 0;
+        std::string code;
+        if (!splitNumberedLine(text, lineNumber, code)) {
+            lineNumber = 0;
+        }
+        windowShadow.push_back({hashEditorLine(text), lineNumber});
+    }
+    for (size_t k = common; k < oldLength; ++k) {
+        m_textBuffer->deleteLine(prefix + common);
+        m_lastDeltas.push_back({LineDelta::Kind::Delete, prefix + common, 0, std::string(), version});
+    }
+    
+    // Splice the shadows to match
+    m_editorShadow.erase(m_editorShadow.begin() + prefix, m_editorShadow.begin() + oldEnd);
+    m_editorShadow.insert(m_editorShadow.begin() + prefix, windowShadow.begin(), windowShadow.end());
+    m_documentShadow = std::move(hashes);
+    m_documentVersionAtShadow = m_document->getVersion();
+    
+    m_editorOrdered = true;
+    int previous = 0;
+    for (const auto& line : m_editorShadow) {
+        if (line.lineNumber <= previous) {
+            m_editorOrdered = false;
+            break;
+        }
+        previous = line.lineNumber;
+    }
+    
+    return true;
+}
+
 } // namespace FBRunner3
\ No newline at end of file
@@ -12,8 +12,10 @@
 #ifndef EDITOR_BRIDGE_H
 #define EDITOR_BRIDGE_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 // Forward declarations
 namespace SuperTerminal {
@@ -47,8 +49,12 @@ namespace FBRunner3 {
 //      - Editor now displays the program for screen-based editing
 //
 // Design Notes:
-//   - This is the MVP (Minimum Viable Product) approach: sync on mode switch
-//   - Future enhancement: real-time two-way binding
+//   - Sync happens on mode switch, but only changed lines are propagated:
+//     the bridge keeps a per-line shadow (content hash, BASIC line number)
+//     of both sides as of the last sync, diffs each side against it and
+//     applies the resulting insert/delete/replace deltas to the other side
+//   - Falls back to a full copy when the shadow cannot be trusted (first
+//     sync, both sides edited, unnumbered or out-of-order editor lines)
 //   - The bridge handles line number display/hiding automatically
 //   - Cursor position is preserved where possible during sync
 //
@@ -59,6 +65,17 @@ namespace FBRunner3 {
 
 class EditorBridge {
 public:
+    /// One line-level change propagated by a sync
+    struct LineDelta {
+        enum class Kind { Insert, Delete, Replace };
+
+        Kind kind;
+        size_t index;           // Line index on the receiving side
+        int lineNumber;         // BASIC line number (0 if unnumbered)
+        std::string text;       // New content (empty for Delete)
+        uint64_t version;       // Sync sequence number that produced it
+    };
+
     // =========================================================================
     // Construction
     // =========================================================================
@@ -138,8 +155,18 @@ public:
     
     /// Force both sides to be marked as synchronized
     /// Use after external operations that modify both sides
+    /// (the next sync re-copies everything rather than trusting the shadow)
     void markSynchronized();
     
+    /// Deltas applied by the most recent sync (empty after a full copy)
+    const std::vector<LineDelta>& getLastDeltas() const;
+    
+    /// Whether the most recent sync propagated deltas rather than copying
+    bool wasLastSyncIncremental() const;
+    
+    /// Sequence number of the most recent sync that changed anything
+    uint64_t getSyncVersion() const;
+    
     /// Get EditorView wrapper for direct access
     /// @return EditorView adapter (creates on first access)
     FasterBASIC::EditorView* getEditorView();
@@ -175,6 +202,23 @@ private:
     size_t m_editorVersionAtLastSync;
     size_t m_shellVersionAtLastSync;
     
+    // Per-line shadow of both sides as of the last sync. Editor line i and
+    // document line i correspond while m_shadowValid is set.
+    struct EditorShadowLine {
+        size_t hash;
+        int lineNumber;         // Parsed BASIC line number (0 if unnumbered)
+    };
+    std::vector<EditorShadowLine> m_editorShadow;
+    std::vector<size_t> m_documentShadow;     // Hash of (line number, text)
+    bool m_shadowValid;
+    bool m_editorOrdered;                     // Every line numbered, ascending
+    size_t m_documentVersionAtShadow;
+    
+    // Delta bookkeeping
+    std::vector<LineDelta> m_lastDeltas;
+    bool m_lastSyncIncremental;
+    uint64_t m_syncVersion;
+    
     // =========================================================================
     // Internal Helpers
     // =========================================================================
@@ -218,6 +262,29 @@ private:
     /// @param line Line with potential "10 " prefix
     /// @return Line without prefix, or original if no prefix found
     std::string stripLineNumberPrefix(const std::string& line) const;
+    
+    // -------------------------------------------------------------------------
+    // Incremental sync
+    // -------------------------------------------------------------------------
+    
+    /// Editor lines as the full sync would see them (no trailing empty line,
+    /// carriage returns removed)
+    std::vector<std::string> readEditorLines() const;
+    
+    /// Split "10 PRINT" into 10 and "PRINT" (same rule as editorTextToDocument)
+    /// @return false if the line has no line number prefix
+    static bool splitNumberedLine(const std::string& line, int& lineNumber, std::string& code);
+    
+    /// Rebuild both shadows from the current contents of both sides
+    void rebuildShadow();
+    
+    /// Apply editor changes since the last sync to the document
+    /// @return false if the change cannot be expressed as deltas
+    bool applyEditorDeltas();
+    
+    /// Apply document changes since the last sync to the editor
+    /// @return false if the change cannot be expressed as deltas
+    bool applyDocumentDeltas();
 };
 
 } // namespace FBRunner3
@@ -8,6 +8,7 @@
 //
 
 #include "FBTBindings.h"
+#include "MappedFile.h"
 #include "../Framework/Debug/Logger.h"
 #include "../FasterBASICT/runtime/data_lua_bindings.h"
 #include "../FasterBASICT/runtime/fileio_lua_bindings.h"
@@ -24,11 +25,24 @@
 #include <lua.hpp>
 #include <string>
 #include <cstring>
+#include <cctype>
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
 #include <chrono>
 #include <thread>
+#include <mutex>
+#include <unordered_map>
+#include <future>
+#include <memory>
+#include <map>
+#include <list>
+#include <queue>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <sys/stat.h>
+#include <unistd.h>
 
 // Video mode constants
 constexpr int VIDEO_MODE_TEXT = 0;
@@ -457,9 +471,13 @@ static int lua_st_gfx_arc_filled(lua_State* L) {
 // Audio API Bindings
 // =============================================================================
 
+// Defined with the background render jobs below
+static void waitForRenders();
+
 static int lua_st_music_play(lua_State* L) {
     const char* abc = luaL_checkstring(L, 1);
     printf("[FBTBindings] music_play called with ABC notation: %s\n", abc);
+    waitForRenders();
     st_music_play(abc);
     printf("[FBTBindings] st_music_play returned\n");
     return 0;
@@ -467,12 +485,14 @@ static int lua_st_music_play(lua_State* L) {
 
 static int lua_st_play_abc(lua_State* L) {
     const char* abc_text = luaL_checkstring(L, 1);
+    waitForRenders();
     st_play_abc(abc_text);
     return 0;
 }
 
 static int lua_st_music_play_file(lua_State* L) {
     const char* path = luaL_checkstring(L, 1);
+    waitForRenders();
     st_music_play_file(path);
     return 0;
 }
@@ -480,16 +500,82 @@ static int lua_st_music_play_file(lua_State* L) {
 static int lua_st_music_play_file_with_format(lua_State* L) {
     const char* path = luaL_checkstring(L, 1);
     const char* format = luaL_checkstring(L, 2);
+    waitForRenders();
     st_music_play_file_with_format(path, format);
     return 0;
 }
 
+// Background render jobs
+//
+// The *_async render bindings start the render on a worker thread and
+// return a job id straight away so level loading can carry on. Poll with
+// render_job_done(id) and collect the outcome with render_job_result(id),
+// which blocks if the job is still running and then releases the id.
+//
+// Renders drive the shared voice and music engines, so they run one after
+// another, and every voice/music binding waits for the renders in flight
+// before touching either engine. Jobs a script never collected are joined
+// and dropped when the script ends.
+struct RenderJob {
+    std::shared_future<int64_t> future;
+};
+
+static std::mutex s_renderJobsMutex;
+static std::unordered_map<int, std::shared_ptr<RenderJob>> s_renderJobs;
+static std::shared_future<int64_t> s_lastRender;    // completes after every earlier render
+static int s_nextRenderJobId = 1;
+
+template <typename RenderFn>
+static int startRenderJob(RenderFn render) {
+    std::lock_guard<std::mutex> lock(s_renderJobsMutex);
+    std::shared_future<int64_t> previous = s_lastRender;
+
+    auto job = std::make_shared<RenderJob>();
+    job->future = std::async(std::launch::async, [previous, render]() -> int64_t {
+        if (previous.valid()) {
+            previous.wait();
+        }
+        return render();
+    }).share();
+
+    s_lastRender = job->future;
+    int jobId = s_nextRenderJobId++;
+    s_renderJobs[jobId] = job;
+    return jobId;
+}
+
+static std::shared_ptr<RenderJob> findRenderJob(int jobId) {
+    std::lock_guard<std::mutex> lock(s_renderJobsMutex);
+    auto it = s_renderJobs.find(jobId);
+    return it != s_renderJobs.end() ? it->second : nullptr;
+}
+
+// Block until no render is using the voice or music engine
+static void waitForRenders() {
+    std::shared_future<int64_t> last;
+    {
+        std::lock_guard<std::mutex> lock(s_renderJobsMutex);
+        last = s_lastRender;
+    }
+    if (last.valid()) {
+        last.wait();
+    }
+}
+
+static void renderJobsReset() {
+    waitForRenders();
+    std::lock_guard<std::mutex> lock(s_renderJobsMutex);
+    s_renderJobs.clear();
+    s_lastRender = std::shared_future<int64_t>();
+}
+
 static int lua_st_music_render_to_wav(lua_State* L) {
     const char* path = luaL_checkstring(L, 1);
     const char* outputPath = luaL_checkstring(L, 2);
     const char* format = luaL_optstring(L, 3, nullptr);
     // In Lua, 0 is truthy! Check numeric value instead
     bool fastRender = (lua_isnumber(L, 4) && lua_tonumber(L, 4) != 0.0);
+    waitForRenders();
     bool success = st_music_render_to_wav(path, outputPath, format, fastRender);
     lua_pushboolean(L, success);
     return 1;
@@ -501,36 +587,100 @@ static int lua_st_music_render_to_slot(lua_State* L) {
     const char* format = luaL_optstring(L, 3, nullptr);
     // In Lua, 0 is truthy! Check numeric value instead
     bool fastRender = (lua_isnumber(L, 4) && lua_tonumber(L, 4) != 0.0);
+    waitForRenders();
     uint32_t resultSlot = st_music_render_to_slot(path, slotNumber, format, fastRender);
     lua_pushinteger(L, resultSlot);
     return 1;
 }
 
+static int lua_st_music_render_to_wav_async(lua_State* L) {
+    std::string path = luaL_checkstring(L, 1);
+    std::string outputPath = luaL_checkstring(L, 2);
+    std::string format = luaL_optstring(L, 3, "");
+    bool hasFormat = !format.empty();    // BASIC passes "" for "detect from file"
+    bool fastRender = (lua_isnumber(L, 4) && lua_tonumber(L, 4) != 0.0);
+
+    int jobId = startRenderJob([=]() -> int64_t {
+        return st_music_render_to_wav(path.c_str(), outputPath.c_str(),
+                                      hasFormat ? format.c_str() : nullptr, fastRender) ? 1 : 0;
+    });
+    lua_pushinteger(L, jobId);
+    return 1;
+}
+
+static int lua_st_music_render_to_slot_async(lua_State* L) {
+    std::string path = luaL_checkstring(L, 1);
+    uint32_t slotNumber = luaL_checkinteger(L, 2);
+    std::string format = luaL_optstring(L, 3, "");
+    bool hasFormat = !format.empty();    // BASIC passes "" for "detect from file"
+    bool fastRender = (lua_isnumber(L, 4) && lua_tonumber(L, 4) != 0.0);
+
+    int jobId = startRenderJob([=]() -> int64_t {
+        return st_music_render_to_slot(path.c_str(), slotNumber,
+                                       hasFormat ? format.c_str() : nullptr, fastRender);
+    });
+    lua_pushinteger(L, jobId);
+    return 1;
+}
+
+static int lua_st_render_job_done(lua_State* L) {
+    int jobId = luaL_checkinteger(L, 1);
+    std::shared_ptr<RenderJob> job = findRenderJob(jobId);
+    if (!job) {
+        return luaL_error(L, "render_job_done: unknown job %d", jobId);
+    }
+    bool done = job->future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    lua_pushboolean(L, done);
+    return 1;
+}
+
+// Returns the render result: 1/0 for WAV renders, the slot for slot renders
+static int lua_st_render_job_result(lua_State* L) {
+    int jobId = luaL_checkinteger(L, 1);
+    std::shared_ptr<RenderJob> job;
+    {
+        std::lock_guard<std::mutex> lock(s_renderJobsMutex);
+        auto it = s_renderJobs.find(jobId);
+        if (it == s_renderJobs.end()) {
+            return luaL_error(L, "render_job_result: unknown job %d", jobId);
+        }
+        job = it->second;
+        s_renderJobs.erase(it);
+    }
+    lua_pushinteger(L, (lua_Integer)job->future.get());
+    return 1;
+}
+
 static int lua_st_music_stop(lua_State* L) {
     (void)L;
+    waitForRenders();
     st_music_stop();
     return 0;
 }
 
 static int lua_st_music_pause(lua_State* L) {
     (void)L;
+    waitForRenders();
     st_music_pause();
     return 0;
 }
 
 static int lua_st_music_resume(lua_State* L) {
     (void)L;
+    waitForRenders();
     st_music_resume();
     return 0;
 }
 
 static int lua_st_music_is_playing(lua_State* L) {
+    waitForRenders();
     lua_pushboolean(L, st_music_is_playing());
     return 1;
 }
 
 static int lua_st_music_set_volume(lua_State* L) {
     float volume = luaL_checknumber(L, 1);
+    waitForRenders();
     st_music_set_volume(volume);
     return 0;
 }
@@ -541,6 +691,7 @@ static int lua_st_music_set_volume(lua_State* L) {
 
 static int lua_st_music_load_string(lua_State* L) {
     const char* abc = luaL_checkstring(L, 1);
+    waitForRenders();
     uint32_t music_id = st_music_load_string(abc);
     lua_pushinteger(L, music_id);
     return 1;
@@ -548,6 +699,7 @@ static int lua_st_music_load_string(lua_State* L) {
 
 static int lua_st_music_load_file(lua_State* L) {
     const char* filename = luaL_checkstring(L, 1);
+    waitForRenders();
     uint32_t music_id = st_music_load_file(filename);
     lua_pushinteger(L, music_id);
     return 1;
@@ -556,18 +708,21 @@ static int lua_st_music_load_file(lua_State* L) {
 static int lua_st_music_play_id(lua_State* L) {
     uint32_t music_id = luaL_checkinteger(L, 1);
     float volume = luaL_optnumber(L, 2, 1.0);
+    waitForRenders();
     st_music_play_id(music_id, volume);
     return 0;
 }
 
 static int lua_st_music_exists(lua_State* L) {
     uint32_t music_id = luaL_checkinteger(L, 1);
+    waitForRenders();
     lua_pushboolean(L, st_music_exists(music_id));
     return 1;
 }
 
 static int lua_st_music_get_title(lua_State* L) {
     uint32_t music_id = luaL_checkinteger(L, 1);
+    waitForRenders();
     const char* title = st_music_get_title(music_id);
     lua_pushstring(L, title);
     return 1;
@@ -575,6 +730,7 @@ static int lua_st_music_get_title(lua_State* L) {
 
 static int lua_st_music_get_composer(lua_State* L) {
     uint32_t music_id = luaL_checkinteger(L, 1);
+    waitForRenders();
     const char* composer = st_music_get_composer(music_id);
     lua_pushstring(L, composer);
     return 1;
@@ -582,6 +738,7 @@ static int lua_st_music_get_composer(lua_State* L) {
 
 static int lua_st_music_get_key(lua_State* L) {
     uint32_t music_id = luaL_checkinteger(L, 1);
+    waitForRenders();
     const char* key = st_music_get_key(music_id);
     lua_pushstring(L, key);
     return 1;
@@ -589,6 +746,7 @@ static int lua_st_music_get_key(lua_State* L) {
 
 static int lua_st_music_get_tempo(lua_State* L) {
     uint32_t music_id = luaL_checkinteger(L, 1);
+    waitForRenders();
     float tempo = st_music_get_tempo(music_id);
     lua_pushnumber(L, tempo);
     return 1;
@@ -596,6 +754,7 @@ static int lua_st_music_get_tempo(lua_State* L) {
 
 static int lua_st_music_free(lua_State* L) {
     uint32_t music_id = luaL_checkinteger(L, 1);
+    waitForRenders();
     bool success = st_music_free(music_id);
     lua_pushboolean(L, success);
     return 1;
@@ -603,17 +762,20 @@ static int lua_st_music_free(lua_State* L) {
 
 static int lua_st_music_free_all(lua_State* L) {
     (void)L;
+    waitForRenders();
     st_music_free_all();
     return 0;
 }
 
 static int lua_st_music_get_count(lua_State* L) {
+    waitForRenders();
     uint32_t count = st_music_get_count();
     lua_pushinteger(L, count);
     return 1;
 }
 
 static int lua_st_music_get_memory(lua_State* L) {
+    waitForRenders();
     uint32_t memory = st_music_get_memory();
     lua_pushinteger(L, memory);
     return 1;
@@ -782,12 +944,14 @@ static int lua_st_synth_note(lua_State* L) {
     float duration = luaL_checknumber(L, 2);
     float volume = luaL_optnumber(L, 3, 0.5f);
 
+    waitForRenders();
     st_synth_note(note, duration, volume);
     return 0;
 }
 
 static int lua_st_synth_set_instrument(lua_State* L) {
     int instrument = luaL_checkinteger(L, 1);
+    waitForRenders();
     st_synth_set_instrument(instrument);
     return 0;
 }
@@ -797,6 +961,7 @@ static int lua_st_synth_frequency(lua_State* L) {
     float duration = luaL_checknumber(L, 2);
     float volume = luaL_optnumber(L, 3, 0.5f);
 
+    waitForRenders();
     st_synth_frequency(frequency, duration, volume);
     return 0;
 }
@@ -805,11 +970,76 @@ static int lua_st_synth_frequency(lua_State* L) {
 // Sound Bank API Bindings
 // =============================================================================
 
+// Parameter-keyed cache for the sound_create_* generators. Scripts tend to
+// recreate the same effects on every level load; identical requests now
+// share one sound bank entry instead of resynthesizing the PCM. Entries are
+// reference counted so sound_free_id only releases the buffer once every
+// creator has freed it.
+struct SoundCacheEntry {
+    uint32_t soundId;
+    uint32_t refCount;
+};
+
+static std::mutex s_soundCacheMutex;
+static std::unordered_map<std::string, SoundCacheEntry> s_soundCache;
+static std::unordered_map<uint32_t, std::string> s_soundCacheKeys;
+static uint64_t s_soundCacheHits = 0;
+static uint64_t s_soundCacheMisses = 0;
+
+// Key is the generator name followed by each parameter's bits as a double,
+// so 0.5 and 0.50001 are distinct sounds but int and float spellings of the
+// same value are not.
+template <typename... Params>
+static std::string soundCacheKey(const char* generator, Params... params) {
+    std::string key(generator);
+    key.push_back('\0');
+    for (double p : {static_cast<double>(params)...}) {
+        key.append(reinterpret_cast<const char*>(&p), sizeof(p));
+    }
+    return key;
+}
+
+// Sound IDs are only trusted within one run; a new script starts with an
+// empty cache and fresh counters
+static void soundCacheReset() {
+    std::lock_guard<std::mutex> lock(s_soundCacheMutex);
+    s_soundCache.clear();
+    s_soundCacheKeys.clear();
+    s_soundCacheHits = 0;
+    s_soundCacheMisses = 0;
+}
+
+template <typename CreateFn>
+static uint32_t soundCacheCreate(const std::string& key, CreateFn create) {
+    std::lock_guard<std::mutex> lock(s_soundCacheMutex);
+    auto it = s_soundCache.find(key);
+    if (it != s_soundCache.end()) {
+        if (st_sound_exists(it->second.soundId)) {
+            it->second.refCount++;
+            s_soundCacheHits++;
+            return it->second.soundId;
+        }
+        // Freed behind our back (e.g. sound bank reset) - resynthesize
+        s_soundCacheKeys.erase(it->second.soundId);
+        s_soundCache.erase(it);
+    }
+
+    s_soundCacheMisses++;
+    uint32_t soundId = create();
+    if (soundId != 0) {
+        s_soundCache[key] = {soundId, 1};
+        s_soundCacheKeys[soundId] = key;
+    }
+    return soundId;
+}
+
 static int lua_st_sound_create_beep(lua_State* L) {
     float frequency = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_beep(frequency, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("beep", frequency, duration), [&] {
+        return st_sound_create_beep(frequency, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -818,7 +1048,9 @@ static int lua_st_sound_create_zap(lua_State* L) {
     float frequency = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_zap(frequency, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("zap", frequency, duration), [&] {
+        return st_sound_create_zap(frequency, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -827,7 +1059,9 @@ static int lua_st_sound_create_explode(lua_State* L) {
     float size = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_explode(size, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("explode", size, duration), [&] {
+        return st_sound_create_explode(size, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -836,7 +1070,9 @@ static int lua_st_sound_create_coin(lua_State* L) {
     float pitch = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_coin(pitch, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("coin", pitch, duration), [&] {
+        return st_sound_create_coin(pitch, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -845,7 +1081,9 @@ static int lua_st_sound_create_jump(lua_State* L) {
     float power = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_jump(power, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("jump", power, duration), [&] {
+        return st_sound_create_jump(power, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -854,7 +1092,9 @@ static int lua_st_sound_create_shoot(lua_State* L) {
     float power = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_shoot(power, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("shoot", power, duration), [&] {
+        return st_sound_create_shoot(power, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -863,7 +1103,9 @@ static int lua_st_sound_create_click(lua_State* L) {
     float sharpness = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_click(sharpness, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("click", sharpness, duration), [&] {
+        return st_sound_create_click(sharpness, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -872,7 +1114,9 @@ static int lua_st_sound_create_blip(lua_State* L) {
     float pitch = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_blip(pitch, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("blip", pitch, duration), [&] {
+        return st_sound_create_blip(pitch, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -881,7 +1125,9 @@ static int lua_st_sound_create_pickup(lua_State* L) {
     float brightness = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_pickup(brightness, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("pickup", brightness, duration), [&] {
+        return st_sound_create_pickup(brightness, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -890,7 +1136,9 @@ static int lua_st_sound_create_powerup(lua_State* L) {
     float intensity = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_powerup(intensity, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("powerup", intensity, duration), [&] {
+        return st_sound_create_powerup(intensity, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -899,7 +1147,9 @@ static int lua_st_sound_create_hurt(lua_State* L) {
     float severity = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_hurt(severity, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("hurt", severity, duration), [&] {
+        return st_sound_create_hurt(severity, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -909,7 +1159,10 @@ static int lua_st_sound_create_sweep_up(lua_State* L) {
     float end_freq = luaL_checknumber(L, 2);
     float duration = luaL_checknumber(L, 3);
 
-    uint32_t soundId = st_sound_create_sweep_up(start_freq, end_freq, duration);
+    std::string key = soundCacheKey("sweep_up", start_freq, end_freq, duration);
+    uint32_t soundId = soundCacheCreate(key, [&] {
+        return st_sound_create_sweep_up(start_freq, end_freq, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -919,7 +1172,10 @@ static int lua_st_sound_create_sweep_down(lua_State* L) {
     float end_freq = luaL_checknumber(L, 2);
     float duration = luaL_checknumber(L, 3);
 
-    uint32_t soundId = st_sound_create_sweep_down(start_freq, end_freq, duration);
+    std::string key = soundCacheKey("sweep_down", start_freq, end_freq, duration);
+    uint32_t soundId = soundCacheCreate(key, [&] {
+        return st_sound_create_sweep_down(start_freq, end_freq, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -928,7 +1184,9 @@ static int lua_st_sound_create_big_explosion(lua_State* L) {
     float size = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_big_explosion(size, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("big_explosion", size, duration), [&] {
+        return st_sound_create_big_explosion(size, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -937,7 +1195,9 @@ static int lua_st_sound_create_small_explosion(lua_State* L) {
     float intensity = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_small_explosion(intensity, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("small_explosion", intensity, duration), [&] {
+        return st_sound_create_small_explosion(intensity, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -946,7 +1206,10 @@ static int lua_st_sound_create_distant_explosion(lua_State* L) {
     float distance = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_distant_explosion(distance, duration);
+    std::string key = soundCacheKey("distant_explosion", distance, duration);
+    uint32_t soundId = soundCacheCreate(key, [&] {
+        return st_sound_create_distant_explosion(distance, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -955,7 +1218,9 @@ static int lua_st_sound_create_metal_explosion(lua_State* L) {
     float shrapnel = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_metal_explosion(shrapnel, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("metal_explosion", shrapnel, duration), [&] {
+        return st_sound_create_metal_explosion(shrapnel, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -964,7 +1229,9 @@ static int lua_st_sound_create_bang(lua_State* L) {
     float intensity = luaL_checknumber(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_bang(intensity, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("bang", intensity, duration), [&] {
+        return st_sound_create_bang(intensity, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -973,7 +1240,9 @@ static int lua_st_sound_create_random_beep(lua_State* L) {
     uint32_t seed = luaL_checkinteger(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_random_beep(seed, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("random_beep", seed, duration), [&] {
+        return st_sound_create_random_beep(seed, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -984,7 +1253,9 @@ static int lua_st_sound_create_tone(lua_State* L) {
     float duration = luaL_checknumber(L, 2);
     int waveform = luaL_checkinteger(L, 3);
 
-    uint32_t soundId = st_sound_create_tone(frequency, duration, waveform);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("tone", frequency, duration, waveform), [&] {
+        return st_sound_create_tone(frequency, duration, waveform);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -998,7 +1269,11 @@ static int lua_st_sound_create_note(lua_State* L) {
     float sustainLevel = luaL_checknumber(L, 6);
     float release = luaL_checknumber(L, 7);
 
-    uint32_t soundId = st_sound_create_note(note, duration, waveform, attack, decay, sustainLevel, release);
+    std::string key = soundCacheKey("note", note, duration, waveform, attack, decay,
+                                    sustainLevel, release);
+    uint32_t soundId = soundCacheCreate(key, [&] {
+        return st_sound_create_note(note, duration, waveform, attack, decay, sustainLevel, release);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -1007,7 +1282,9 @@ static int lua_st_sound_create_noise(lua_State* L) {
     int noiseType = luaL_checkinteger(L, 1);
     float duration = luaL_checknumber(L, 2);
 
-    uint32_t soundId = st_sound_create_noise(noiseType, duration);
+    uint32_t soundId = soundCacheCreate(soundCacheKey("noise", noiseType, duration), [&] {
+        return st_sound_create_noise(noiseType, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -1019,7 +1296,10 @@ static int lua_st_sound_create_fm(lua_State* L) {
     float mod_index = luaL_checknumber(L, 3);
     float duration = luaL_checknumber(L, 4);
 
-    uint32_t soundId = st_sound_create_fm(carrier_freq, modulator_freq, mod_index, duration);
+    std::string key = soundCacheKey("fm", carrier_freq, modulator_freq, mod_index, duration);
+    uint32_t soundId = soundCacheCreate(key, [&] {
+        return st_sound_create_fm(carrier_freq, modulator_freq, mod_index, duration);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -1032,8 +1312,12 @@ static int lua_st_sound_create_filtered_tone(lua_State* L) {
     float cutoff = luaL_checknumber(L, 5);
     float resonance = luaL_checknumber(L, 6);
 
-    uint32_t soundId = st_sound_create_filtered_tone(frequency, duration, waveform,
-                                                      filter_type, cutoff, resonance);
+    std::string key = soundCacheKey("filtered_tone", frequency, duration, waveform, filter_type,
+                                    cutoff, resonance);
+    uint32_t soundId = soundCacheCreate(key, [&] {
+        return st_sound_create_filtered_tone(frequency, duration, waveform,
+                                             filter_type, cutoff, resonance);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -1050,9 +1334,13 @@ static int lua_st_sound_create_filtered_note(lua_State* L) {
     float cutoff = luaL_checknumber(L, 9);
     float resonance = luaL_checknumber(L, 10);
 
-    uint32_t soundId = st_sound_create_filtered_note(note, duration, waveform,
-                                                      attack, decay, sustain_level, release,
-                                                      filter_type, cutoff, resonance);
+    std::string key = soundCacheKey("filtered_note", note, duration, waveform, attack, decay,
+                                    sustain_level, release, filter_type, cutoff, resonance);
+    uint32_t soundId = soundCacheCreate(key, [&] {
+        return st_sound_create_filtered_note(note, duration, waveform,
+                                             attack, decay, sustain_level, release,
+                                             filter_type, cutoff, resonance);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -1066,8 +1354,12 @@ static int lua_st_sound_create_with_reverb(lua_State* L) {
     float damping = luaL_checknumber(L, 5);
     float wet = luaL_checknumber(L, 6);
 
-    uint32_t soundId = st_sound_create_with_reverb(frequency, duration, waveform,
-                                                    room_size, damping, wet);
+    std::string key = soundCacheKey("with_reverb", frequency, duration, waveform, room_size,
+                                    damping, wet);
+    uint32_t soundId = soundCacheCreate(key, [&] {
+        return st_sound_create_with_reverb(frequency, duration, waveform,
+                                           room_size, damping, wet);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -1080,8 +1372,12 @@ static int lua_st_sound_create_with_delay(lua_State* L) {
     float feedback = luaL_checknumber(L, 5);
     float mix = luaL_checknumber(L, 6);
 
-    uint32_t soundId = st_sound_create_with_delay(frequency, duration, waveform,
-                                                   delay_time, feedback, mix);
+    std::string key = soundCacheKey("with_delay", frequency, duration, waveform, delay_time,
+                                    feedback, mix);
+    uint32_t soundId = soundCacheCreate(key, [&] {
+        return st_sound_create_with_delay(frequency, duration, waveform,
+                                          delay_time, feedback, mix);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -1094,8 +1390,12 @@ static int lua_st_sound_create_with_distortion(lua_State* L) {
     float tone = luaL_checknumber(L, 5);
     float level = luaL_checknumber(L, 6);
 
-    uint32_t soundId = st_sound_create_with_distortion(frequency, duration, waveform,
-                                                        drive, tone, level);
+    std::string key = soundCacheKey("with_distortion", frequency, duration, waveform, drive,
+                                    tone, level);
+    uint32_t soundId = soundCacheCreate(key, [&] {
+        return st_sound_create_with_distortion(frequency, duration, waveform,
+                                               drive, tone, level);
+    });
     lua_pushinteger(L, soundId);
     return 1;
 }
@@ -1121,12 +1421,34 @@ static int lua_st_sound_play_with_fade(lua_State* L) {
 static int lua_st_sound_free_id(lua_State* L) {
     uint32_t soundId = luaL_checkinteger(L, 1);
 
+    {
+        std::lock_guard<std::mutex> lock(s_soundCacheMutex);
+        auto keyIt = s_soundCacheKeys.find(soundId);
+        if (keyIt != s_soundCacheKeys.end()) {
+            auto entryIt = s_soundCache.find(keyIt->second);
+            if (entryIt != s_soundCache.end() && --entryIt->second.refCount > 0) {
+                // Still shared by another creator - keep the buffer
+                lua_pushboolean(L, true);
+                return 1;
+            }
+            if (entryIt != s_soundCache.end()) {
+                s_soundCache.erase(entryIt);
+            }
+            s_soundCacheKeys.erase(keyIt);
+        }
+    }
+
     bool freed = st_sound_free_id(soundId);
     lua_pushboolean(L, freed);
     return 1;
 }
 
 static int lua_st_sound_free_all(lua_State* L) {
+    {
+        std::lock_guard<std::mutex> lock(s_soundCacheMutex);
+        s_soundCache.clear();
+        s_soundCacheKeys.clear();
+    }
     st_sound_free_all();
     return 0;
 }
@@ -1151,35 +1473,385 @@ static int lua_st_sound_get_memory_usage(lua_State* L) {
     return 1;
 }
 
+static int lua_st_sound_cache_get_hits(lua_State* L) {
+    std::lock_guard<std::mutex> lock(s_soundCacheMutex);
+    lua_pushinteger(L, (lua_Integer)s_soundCacheHits);
+    return 1;
+}
+
+static int lua_st_sound_cache_get_misses(lua_State* L) {
+    std::lock_guard<std::mutex> lock(s_soundCacheMutex);
+    lua_pushinteger(L, (lua_Integer)s_soundCacheMisses);
+    return 1;
+}
+
 // =============================================================================
 // Voice Controller API Bindings
 // =============================================================================
 
+// Coalesced voice parameter writes
+//
+// Continuous voice parameters (frequency, volume, pan, filter cutoff, ...)
+// are staged here instead of calling into the audio engine on every
+// binding call. Repeated writes to the same parameter before the next flush
+// overwrite the staged value, so a script sweeping a filter several times a
+// frame reaches the audio thread once per frame. Anything order-sensitive
+// (gates, waveforms, timeline waits, reads) flushes first, so the observable
+// ordering is unchanged. Only touched from the script thread.
+enum VoiceParam {
+    VOICE_PARAM_FREQUENCY,
+    VOICE_PARAM_VOLUME,
+    VOICE_PARAM_PAN,
+    VOICE_PARAM_PULSE_WIDTH,
+    VOICE_PARAM_DETUNE,
+    VOICE_PARAM_PORTAMENTO,
+    VOICE_PARAM_DELAY_TIME,
+    VOICE_PARAM_DELAY_FEEDBACK,
+    VOICE_PARAM_DELAY_MIX,
+    VOICE_PARAM_COUNT
+};
+
+// Slot 0 holds the global parameters, slots 1-8 the voices
+enum GlobalVoiceParam {
+    GLOBAL_PARAM_FILTER_CUTOFF,
+    GLOBAL_PARAM_FILTER_RESONANCE,
+    GLOBAL_PARAM_MASTER_VOLUME
+};
+
+constexpr int VOICE_PARAM_SLOTS = 9;
+
+struct PendingVoiceParam {
+    float value;
+    bool dirty;
+};
+
+static PendingVoiceParam s_pendingVoiceParams[VOICE_PARAM_SLOTS][VOICE_PARAM_COUNT];
+static uint16_t s_pendingVoiceOrder[VOICE_PARAM_SLOTS * VOICE_PARAM_COUNT];
+static int s_pendingVoiceCount = 0;
+static uint64_t s_voiceParamsQueued = 0;
+static uint64_t s_voiceParamsCoalesced = 0;
+static uint64_t s_voiceParamsApplied = 0;
+
+// Staging needs a frame loop to flush it, so it is on only between
+// beginScriptRun and endScriptRun. The REPL's immediate mode and the
+// terminal-only voice bindings have no frame loop and write straight through.
+static bool s_voiceParamStaging = false;
+
+// Voice state written through the bindings during this run (cleared at
+// script start and by voice_reset_all). The engine has no getters for most
+// settings, so anything that borrows the voices (VOICE_BENCHMARK) resets
+// them and replays this to put them back. Each slot has a fixed field per
+// setting plus a bit saying it was written, so recording is a store on the
+// setter's path. Gates replay last so notes restart on restored settings.
+enum VoiceShadowInt {
+    SHADOW_WAVEFORM,
+    SHADOW_PHYSICAL_MODEL,
+    SHADOW_NOTE,
+    SHADOW_FILTER_ROUTING,
+    SHADOW_RING_MOD,
+    SHADOW_SYNC,
+    SHADOW_DELAY_ENABLE,
+    SHADOW_FILTER_TYPE,         // slot 0 only
+    SHADOW_FILTER_ENABLED,      // slot 0 only
+    SHADOW_GATE,
+    SHADOW_INT_COUNT
+};
+
+enum VoiceShadowFloat {
+    SHADOW_PHYSICAL_DAMPING,
+    SHADOW_PHYSICAL_BRIGHTNESS,
+    SHADOW_PHYSICAL_EXCITATION,
+    SHADOW_PHYSICAL_RESONANCE,
+    SHADOW_PHYSICAL_TENSION,
+    SHADOW_PHYSICAL_PRESSURE,
+    SHADOW_FLOAT_COUNT
+};
+
+struct VoiceShadow {
+    uint32_t paramSet;          // bit per VoiceParam (GlobalVoiceParam in slot 0)
+    uint32_t intSet;            // bit per VoiceShadowInt
+    uint32_t floatSet;          // bit per VoiceShadowFloat
+    bool envelopeSet;
+    bool noteNameSet;
+    float params[VOICE_PARAM_COUNT];
+    int ints[SHADOW_INT_COUNT];
+    float floats[SHADOW_FLOAT_COUNT];
+    float envelope[4];          // attack ms, decay ms, sustain level, release ms
+    char noteName[8];
+};
+
+static VoiceShadow s_voiceShadow[VOICE_PARAM_SLOTS];
+
+static inline VoiceShadow* voiceShadowSlot(int voice) {
+    return voice >= 0 && voice < VOICE_PARAM_SLOTS ? &s_voiceShadow[voice] : nullptr;
+}
+
+// A note, a note name and a raw frequency all set the same pitch; keep the last
+static inline void voiceShadowForgetPitch(VoiceShadow& shadow) {
+    shadow.paramSet &= ~(1u << VOICE_PARAM_FREQUENCY);
+    shadow.intSet &= ~(1u << SHADOW_NOTE);
+    shadow.noteNameSet = false;
+}
+
+static inline void voiceShadowParam(int slot, int param, float value) {
+    VoiceShadow* shadow = voiceShadowSlot(slot);
+    if (!shadow || param < 0 || param >= VOICE_PARAM_COUNT) {
+        return;
+    }
+    if (slot != 0 && param == VOICE_PARAM_FREQUENCY) {
+        voiceShadowForgetPitch(*shadow);
+    }
+    shadow->params[param] = value;
+    shadow->paramSet |= 1u << param;
+}
+
+static inline void voiceShadowInt(int voice, VoiceShadowInt setting, int value) {
+    VoiceShadow* shadow = voiceShadowSlot(voice);
+    if (!shadow) {
+        return;
+    }
+    if (setting == SHADOW_NOTE) {
+        voiceShadowForgetPitch(*shadow);
+    }
+    shadow->ints[setting] = value;
+    shadow->intSet |= 1u << setting;
+}
+
+static inline void voiceShadowFloat(int voice, VoiceShadowFloat setting, float value) {
+    VoiceShadow* shadow = voiceShadowSlot(voice);
+    if (shadow) {
+        shadow->floats[setting] = value;
+        shadow->floatSet |= 1u << setting;
+    }
+}
+
+static void voiceShadowEnvelope(int voice, float attackMs, float decayMs, float sustainLevel, float releaseMs) {
+    VoiceShadow* shadow = voiceShadowSlot(voice);
+    if (shadow) {
+        shadow->envelope[0] = attackMs;
+        shadow->envelope[1] = decayMs;
+        shadow->envelope[2] = sustainLevel;
+        shadow->envelope[3] = releaseMs;
+        shadow->envelopeSet = true;
+    }
+}
+
+static void voiceShadowNoteName(int voice, const char* name) {
+    VoiceShadow* shadow = voiceShadowSlot(voice);
+    if (!shadow) {
+        return;
+    }
+    voiceShadowForgetPitch(*shadow);
+    if (strlen(name) < sizeof(shadow->noteName)) {   // Longer is not a note name
+        strcpy(shadow->noteName, name);
+        shadow->noteNameSet = true;
+    }
+}
+
+static void voiceShadowClear() {
+    memset(s_voiceShadow, 0, sizeof(s_voiceShadow));
+}
+
+static void writeVoiceParam(int slot, int param, float value);
+
+static void writeVoiceShadowInt(int voice, int setting, int value) {
+    switch (setting) {
+        case SHADOW_WAVEFORM:       st_voice_set_waveform(voice, value); break;
+        case SHADOW_PHYSICAL_MODEL: st_voice_set_physical_model(voice, value); break;
+        case SHADOW_NOTE:           st_voice_set_note(voice, value); break;
+        case SHADOW_FILTER_ROUTING: st_voice_set_filter_routing(voice, value); break;
+        case SHADOW_RING_MOD:       st_voice_set_ring_mod(voice, value); break;
+        case SHADOW_SYNC:           st_voice_set_sync(voice, value); break;
+        case SHADOW_DELAY_ENABLE:   st_voice_set_delay_enable(voice, value); break;
+        case SHADOW_FILTER_TYPE:    st_voice_set_filter_type(value); break;
+        case SHADOW_FILTER_ENABLED: st_voice_set_filter_enabled(value); break;
+        case SHADOW_GATE:           st_voice_set_gate(voice, value); break;
+    }
+}
+
+static void writeVoiceShadowFloat(int voice, int setting, float value) {
+    switch (setting) {
+        case SHADOW_PHYSICAL_DAMPING:    st_voice_set_physical_damping(voice, value); break;
+        case SHADOW_PHYSICAL_BRIGHTNESS: st_voice_set_physical_brightness(voice, value); break;
+        case SHADOW_PHYSICAL_EXCITATION: st_voice_set_physical_excitation(voice, value); break;
+        case SHADOW_PHYSICAL_RESONANCE:  st_voice_set_physical_resonance(voice, value); break;
+        case SHADOW_PHYSICAL_TENSION:    st_voice_set_physical_tension(voice, value); break;
+        case SHADOW_PHYSICAL_PRESSURE:   st_voice_set_physical_pressure(voice, value); break;
+    }
+}
+
+static void voiceShadowRestore() {
+    st_voice_reset_all();
+    for (int voice = 0; voice < VOICE_PARAM_SLOTS; voice++) {
+        const VoiceShadow& shadow = s_voiceShadow[voice];
+        for (int setting = 0; setting < SHADOW_GATE; setting++) {
+            if (shadow.intSet & (1u << setting)) {
+                writeVoiceShadowInt(voice, setting, shadow.ints[setting]);
+            }
+        }
+        for (int setting = 0; setting < SHADOW_FLOAT_COUNT; setting++) {
+            if (shadow.floatSet & (1u << setting)) {
+                writeVoiceShadowFloat(voice, setting, shadow.floats[setting]);
+            }
+        }
+        if (shadow.envelopeSet) {
+            st_voice_set_envelope(voice, shadow.envelope[0], shadow.envelope[1],
+                                  shadow.envelope[2], shadow.envelope[3]);
+        }
+        if (shadow.noteNameSet) {
+            st_voice_set_note_name(voice, shadow.noteName);
+        }
+        for (int param = 0; param < VOICE_PARAM_COUNT; param++) {
+            if (shadow.paramSet & (1u << param)) {
+                writeVoiceParam(voice, param, shadow.params[param]);
+            }
+        }
+    }
+    for (int voice = 1; voice < VOICE_PARAM_SLOTS; voice++) {
+        if (s_voiceShadow[voice].intSet & (1u << SHADOW_GATE)) {
+            st_voice_set_gate(voice, s_voiceShadow[voice].ints[SHADOW_GATE]);
+        }
+    }
+}
+
+static void writeVoiceParam(int slot, int param, float value) {
+    if (slot == 0) {
+        switch (param) {
+            case GLOBAL_PARAM_FILTER_CUTOFF:    st_voice_set_filter_cutoff(value); break;
+            case GLOBAL_PARAM_FILTER_RESONANCE: st_voice_set_filter_resonance(value); break;
+            case GLOBAL_PARAM_MASTER_VOLUME:    st_voice_set_master_volume(value); break;
+        }
+        return;
+    }
+    switch (param) {
+        case VOICE_PARAM_FREQUENCY:      st_voice_set_frequency(slot, value); break;
+        case VOICE_PARAM_VOLUME:         st_voice_set_volume(slot, value); break;
+        case VOICE_PARAM_PAN:            st_voice_set_pan(slot, value); break;
+        case VOICE_PARAM_PULSE_WIDTH:    st_voice_set_pulse_width(slot, value); break;
+        case VOICE_PARAM_DETUNE:         st_voice_set_detune(slot, value); break;
+        case VOICE_PARAM_PORTAMENTO:     st_voice_set_portamento(slot, value); break;
+        case VOICE_PARAM_DELAY_TIME:     st_voice_set_delay_time(slot, value); break;
+        case VOICE_PARAM_DELAY_FEEDBACK: st_voice_set_delay_feedback(slot, value); break;
+        case VOICE_PARAM_DELAY_MIX:      st_voice_set_delay_mix(slot, value); break;
+    }
+}
+
+static void applyVoiceParam(int slot, int param, float value) {
+    voiceShadowParam(slot, param, value);
+    writeVoiceParam(slot, param, value);
+}
+
+static void queueVoiceParam(int slot, int param, float value) {
+    if (!s_voiceParamStaging || slot < 0 || slot >= VOICE_PARAM_SLOTS) {
+        // Unstaged or out of range - let the engine handle it as before
+        waitForRenders();
+        applyVoiceParam(slot, param, value);
+        return;
+    }
+
+    s_voiceParamsQueued++;
+    PendingVoiceParam& pending = s_pendingVoiceParams[slot][param];
+    if (pending.dirty) {
+        s_voiceParamsCoalesced++;
+    } else {
+        pending.dirty = true;
+        s_pendingVoiceOrder[s_pendingVoiceCount++] = (uint16_t)(slot * VOICE_PARAM_COUNT + param);
+    }
+    pending.value = value;
+}
+
+void flushVoiceParameters() {
+    if (s_pendingVoiceCount == 0) {
+        return;
+    }
+    waitForRenders();
+    for (int i = 0; i < s_pendingVoiceCount; i++) {
+        int slot = s_pendingVoiceOrder[i] / VOICE_PARAM_COUNT;
+        int param = s_pendingVoiceOrder[i] % VOICE_PARAM_COUNT;
+        PendingVoiceParam& pending = s_pendingVoiceParams[slot][param];
+        pending.dirty = false;
+        applyVoiceParam(slot, param, pending.value);
+        s_voiceParamsApplied++;
+    }
+    s_pendingVoiceCount = 0;
+}
+
+// Called by every binding that reads or writes the voice engine directly:
+// renders in flight finish first, then staged writes land in order
+static void syncVoiceState() {
+    waitForRenders();
+    flushVoiceParameters();
+}
+
+// Staged writes and counters belong to one run: the next script starts
+// with nothing pending and the counters at zero
+static void voiceStagingReset() {
+    for (int i = 0; i < s_pendingVoiceCount; i++) {
+        int slot = s_pendingVoiceOrder[i] / VOICE_PARAM_COUNT;
+        int param = s_pendingVoiceOrder[i] % VOICE_PARAM_COUNT;
+        s_pendingVoiceParams[slot][param].dirty = false;
+    }
+    s_pendingVoiceCount = 0;
+    s_voiceParamsQueued = 0;
+    s_voiceParamsCoalesced = 0;
+    s_voiceParamsApplied = 0;
+}
+
+// Returns pending depth, coalesced writes and applied writes since start
+static int lua_st_voice_queue_stats(lua_State* L) {
+    lua_pushinteger(L, s_pendingVoiceCount);
+    lua_pushinteger(L, (lua_Integer)s_voiceParamsCoalesced);
+    lua_pushinteger(L, (lua_Integer)s_voiceParamsApplied);
+    return 3;
+}
+
+static int lua_st_voice_queue_get_depth(lua_State* L) {
+    lua_pushinteger(L, s_pendingVoiceCount);
+    return 1;
+}
+
+static int lua_st_voice_queue_get_coalesced(lua_State* L) {
+    lua_pushinteger(L, (lua_Integer)s_voiceParamsCoalesced);
+    return 1;
+}
+
+static int lua_st_voice_flush(lua_State* L) {
+    (void)L;
+    syncVoiceState();
+    return 0;
+}
+
 static int lua_st_voice_set_waveform(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int waveform = luaL_checkinteger(L, 2);
+    syncVoiceState();
     st_voice_set_waveform(voiceNum, waveform);
+    voiceShadowInt(voiceNum, SHADOW_WAVEFORM, waveform);
     return 0;
 }
 
 static int lua_st_voice_set_frequency(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float frequencyHz = luaL_checknumber(L, 2);
-    st_voice_set_frequency(voiceNum, frequencyHz);
+    queueVoiceParam(voiceNum, VOICE_PARAM_FREQUENCY, frequencyHz);
     return 0;
 }
 
 static int lua_st_voice_set_note(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int midiNote = luaL_checkinteger(L, 2);
+    syncVoiceState();
     st_voice_set_note(voiceNum, midiNote);
+    voiceShadowInt(voiceNum, SHADOW_NOTE, midiNote);
     return 0;
 }
 
 static int lua_st_voice_set_note_name(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     const char* noteName = luaL_checkstring(L, 2);
+    syncVoiceState();
     st_voice_set_note_name(voiceNum, noteName);
+    voiceShadowNoteName(voiceNum, noteName);
     return 0;
 }
 
@@ -1189,69 +1861,80 @@ static int lua_st_voice_set_envelope(lua_State* L) {
     float decayMs = luaL_checknumber(L, 3);
     float sustainLevel = luaL_checknumber(L, 4);
     float releaseMs = luaL_checknumber(L, 5);
+    syncVoiceState();
     st_voice_set_envelope(voiceNum, attackMs, decayMs, sustainLevel, releaseMs);
+    voiceShadowEnvelope(voiceNum, attackMs, decayMs, sustainLevel, releaseMs);
     return 0;
 }
 
 static int lua_st_voice_set_gate(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int gateOn = luaL_checkinteger(L, 2);
+    syncVoiceState();
     st_voice_set_gate(voiceNum, gateOn);
+    voiceShadowInt(voiceNum, SHADOW_GATE, gateOn);
     return 0;
 }
 
 static int lua_st_voice_set_volume(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float volume = luaL_checknumber(L, 2);
-    st_voice_set_volume(voiceNum, volume);
+    queueVoiceParam(voiceNum, VOICE_PARAM_VOLUME, volume);
     return 0;
 }
 
 static int lua_st_voice_set_pulse_width(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float pulseWidth = luaL_checknumber(L, 2);
-    st_voice_set_pulse_width(voiceNum, pulseWidth);
+    queueVoiceParam(voiceNum, VOICE_PARAM_PULSE_WIDTH, pulseWidth);
     return 0;
 }
 
 static int lua_st_voice_set_filter_routing(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int enabled = luaL_checkinteger(L, 2);
+    syncVoiceState();
     st_voice_set_filter_routing(voiceNum, enabled);
+    voiceShadowInt(voiceNum, SHADOW_FILTER_ROUTING, enabled);
     return 0;
 }
 
 static int lua_st_voice_set_filter_type(lua_State* L) {
     int filterType = luaL_checkinteger(L, 1);
+    syncVoiceState();
     st_voice_set_filter_type(filterType);
+    voiceShadowInt(0, SHADOW_FILTER_TYPE, filterType);
     return 0;
 }
 
 static int lua_st_voice_set_filter_cutoff(lua_State* L) {
     float cutoffHz = luaL_checknumber(L, 1);
-    st_voice_set_filter_cutoff(cutoffHz);
+    queueVoiceParam(0, GLOBAL_PARAM_FILTER_CUTOFF, cutoffHz);
     return 0;
 }
 
 static int lua_st_voice_set_filter_resonance(lua_State* L) {
     float resonance = luaL_checknumber(L, 1);
-    st_voice_set_filter_resonance(resonance);
+    queueVoiceParam(0, GLOBAL_PARAM_FILTER_RESONANCE, resonance);
     return 0;
 }
 
 static int lua_st_voice_set_filter_enabled(lua_State* L) {
     int enabled = luaL_checkinteger(L, 1);
+    syncVoiceState();
     st_voice_set_filter_enabled(enabled);
+    voiceShadowInt(0, SHADOW_FILTER_ENABLED, enabled);
     return 0;
 }
 
 static int lua_st_voice_set_master_volume(lua_State* L) {
     float volume = luaL_checknumber(L, 1);
-    st_voice_set_master_volume(volume);
+    queueVoiceParam(0, GLOBAL_PARAM_MASTER_VOLUME, volume);
     return 0;
 }
 
 static int lua_st_voice_get_master_volume(lua_State* L) {
+    syncVoiceState();
     float volume = st_voice_get_master_volume();
     lua_pushnumber(L, volume);
     return 1;
@@ -1259,17 +1942,21 @@ static int lua_st_voice_get_master_volume(lua_State* L) {
 
 static int lua_st_voice_reset_all(lua_State* L) {
     (void)L;
+    syncVoiceState();
     st_voice_reset_all();
+    voiceShadowClear();
     return 0;
 }
 
 static int lua_st_voice_get_active_count(lua_State* L) {
+    syncVoiceState();
     int count = st_voice_get_active_count();
     lua_pushinteger(L, count);
     return 1;
 }
 
 static int lua_st_voices_are_playing(lua_State* L) {
+    syncVoiceState();
     int playing = st_voices_are_playing();
     lua_pushboolean(L, playing);
     return 1;
@@ -1277,6 +1964,7 @@ static int lua_st_voices_are_playing(lua_State* L) {
 
 static int lua_st_voice_direct(lua_State* L) {
     const char* destination = luaL_checkstring(L, 1);
+    syncVoiceState();
     st_voice_direct(destination);
     return 0;
 }
@@ -1285,6 +1973,7 @@ static int lua_st_voice_direct_slot(lua_State* L) {
     int slotNum = luaL_checkinteger(L, 1);
     float volume = luaL_checknumber(L, 2);
     float duration = luaL_optnumber(L, 3, 0.0f);
+    syncVoiceState();
     uint32_t soundId = st_voice_direct_slot(slotNum, volume, duration);
     lua_pushinteger(L, soundId);
     return 1;
@@ -1293,6 +1982,7 @@ static int lua_st_voice_direct_slot(lua_State* L) {
 static int lua_st_vscript_save_to_bank(lua_State* L) {
     const char* scriptName = luaL_checkstring(L, 1);
     float duration = luaL_optnumber(L, 2, 0.0f);
+    syncVoiceState();
     uint32_t soundId = st_vscript_save_to_bank(scriptName, duration);
     lua_pushinteger(L, soundId);
     return 1;
@@ -1305,7 +1995,7 @@ static int lua_st_vscript_save_to_bank(lua_State* L) {
 static int lua_st_voice_set_pan(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float pan = luaL_checknumber(L, 2);
-    st_voice_set_pan(voiceNum, pan);
+    queueVoiceParam(voiceNum, VOICE_PARAM_PAN, pan);
     return 0;
 }
 
@@ -1316,28 +2006,32 @@ static int lua_st_voice_set_pan(lua_State* L) {
 static int lua_st_voice_set_ring_mod(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int sourceVoice = luaL_checkinteger(L, 2);
+    syncVoiceState();
     st_voice_set_ring_mod(voiceNum, sourceVoice);
+    voiceShadowInt(voiceNum, SHADOW_RING_MOD, sourceVoice);
     return 0;
 }
 
 static int lua_st_voice_set_sync(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int sourceVoice = luaL_checkinteger(L, 2);
+    syncVoiceState();
     st_voice_set_sync(voiceNum, sourceVoice);
+    voiceShadowInt(voiceNum, SHADOW_SYNC, sourceVoice);
     return 0;
 }
 
 static int lua_st_voice_set_portamento(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float time = luaL_checknumber(L, 2);
-    st_voice_set_portamento(voiceNum, time);
+    queueVoiceParam(voiceNum, VOICE_PARAM_PORTAMENTO, time);
     return 0;
 }
 
 static int lua_st_voice_set_detune(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float cents = luaL_checknumber(L, 2);
-    st_voice_set_detune(voiceNum, cents);
+    queueVoiceParam(voiceNum, VOICE_PARAM_DETUNE, cents);
     return 0;
 }
 
@@ -1348,28 +2042,30 @@ static int lua_st_voice_set_detune(lua_State* L) {
 static int lua_st_voice_set_delay_enable(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int enabled = luaL_checkinteger(L, 2);
+    syncVoiceState();
     st_voice_set_delay_enable(voiceNum, enabled);
+    voiceShadowInt(voiceNum, SHADOW_DELAY_ENABLE, enabled);
     return 0;
 }
 
 static int lua_st_voice_set_delay_time(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float time = luaL_checknumber(L, 2);
-    st_voice_set_delay_time(voiceNum, time);
+    queueVoiceParam(voiceNum, VOICE_PARAM_DELAY_TIME, time);
     return 0;
 }
 
 static int lua_st_voice_set_delay_feedback(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float feedback = luaL_checknumber(L, 2);
-    st_voice_set_delay_feedback(voiceNum, feedback);
+    queueVoiceParam(voiceNum, VOICE_PARAM_DELAY_FEEDBACK, feedback);
     return 0;
 }
 
 static int lua_st_voice_set_delay_mix(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float mix = luaL_checknumber(L, 2);
-    st_voice_set_delay_mix(voiceNum, mix);
+    queueVoiceParam(voiceNum, VOICE_PARAM_DELAY_MIX, mix);
     return 0;
 }
 
@@ -1380,6 +2076,7 @@ static int lua_st_voice_set_delay_mix(lua_State* L) {
 static int lua_st_lfo_set_waveform(lua_State* L) {
     int lfoNum = luaL_checkinteger(L, 1);
     int waveform = luaL_checkinteger(L, 2);
+    flushVoiceParameters();
     st_lfo_set_waveform(lfoNum, waveform);
     return 0;
 }
@@ -1387,12 +2084,14 @@ static int lua_st_lfo_set_waveform(lua_State* L) {
 static int lua_st_lfo_set_rate(lua_State* L) {
     int lfoNum = luaL_checkinteger(L, 1);
     float rateHz = luaL_checknumber(L, 2);
+    flushVoiceParameters();
     st_lfo_set_rate(lfoNum, rateHz);
     return 0;
 }
 
 static int lua_st_lfo_reset(lua_State* L) {
     int lfoNum = luaL_checkinteger(L, 1);
+    flushVoiceParameters();
     st_lfo_reset(lfoNum);
     return 0;
 }
@@ -1401,6 +2100,7 @@ static int lua_st_lfo_to_pitch(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int lfoNum = luaL_checkinteger(L, 2);
     float depthCents = luaL_checknumber(L, 3);
+    flushVoiceParameters();
     st_lfo_to_pitch(voiceNum, lfoNum, depthCents);
     return 0;
 }
@@ -1409,6 +2109,7 @@ static int lua_st_lfo_to_volume(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int lfoNum = luaL_checkinteger(L, 2);
     float depth = luaL_checknumber(L, 3);
+    flushVoiceParameters();
     st_lfo_to_volume(voiceNum, lfoNum, depth);
     return 0;
 }
@@ -1417,6 +2118,7 @@ static int lua_st_lfo_to_filter(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int lfoNum = luaL_checkinteger(L, 2);
     float depthHz = luaL_checknumber(L, 3);
+    flushVoiceParameters();
     st_lfo_to_filter(voiceNum, lfoNum, depthHz);
     return 0;
 }
@@ -1425,6 +2127,7 @@ static int lua_st_lfo_to_pulsewidth(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int lfoNum = luaL_checkinteger(L, 2);
     float depth = luaL_checknumber(L, 3);
+    flushVoiceParameters();
     st_lfo_to_pulsewidth(voiceNum, lfoNum, depth);
     return 0;
 }
@@ -1436,54 +2139,69 @@ static int lua_st_lfo_to_pulsewidth(lua_State* L) {
 static int lua_st_voice_set_physical_model(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     int modelType = luaL_checkinteger(L, 2);
+    syncVoiceState();
     st_voice_set_physical_model(voiceNum, modelType);
+    voiceShadowInt(voiceNum, SHADOW_PHYSICAL_MODEL, modelType);
     return 0;
 }
 
 static int lua_st_voice_set_physical_damping(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float damping = luaL_checknumber(L, 2);
+    syncVoiceState();
     st_voice_set_physical_damping(voiceNum, damping);
+    voiceShadowFloat(voiceNum, SHADOW_PHYSICAL_DAMPING, damping);
     return 0;
 }
 
 static int lua_st_voice_set_physical_brightness(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float brightness = luaL_checknumber(L, 2);
+    syncVoiceState();
     st_voice_set_physical_brightness(voiceNum, brightness);
+    voiceShadowFloat(voiceNum, SHADOW_PHYSICAL_BRIGHTNESS, brightness);
     return 0;
 }
 
 static int lua_st_voice_set_physical_excitation(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float excitation = luaL_checknumber(L, 2);
+    syncVoiceState();
     st_voice_set_physical_excitation(voiceNum, excitation);
+    voiceShadowFloat(voiceNum, SHADOW_PHYSICAL_EXCITATION, excitation);
     return 0;
 }
 
 static int lua_st_voice_set_physical_resonance(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float resonance = luaL_checknumber(L, 2);
+    syncVoiceState();
     st_voice_set_physical_resonance(voiceNum, resonance);
+    voiceShadowFloat(voiceNum, SHADOW_PHYSICAL_RESONANCE, resonance);
     return 0;
 }
 
 static int lua_st_voice_set_physical_tension(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float tension = luaL_checknumber(L, 2);
+    syncVoiceState();
     st_voice_set_physical_tension(voiceNum, tension);
+    voiceShadowFloat(voiceNum, SHADOW_PHYSICAL_TENSION, tension);
     return 0;
 }
 
 static int lua_st_voice_set_physical_pressure(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
     float pressure = luaL_checknumber(L, 2);
+    syncVoiceState();
     st_voice_set_physical_pressure(voiceNum, pressure);
+    voiceShadowFloat(voiceNum, SHADOW_PHYSICAL_PRESSURE, pressure);
     return 0;
 }
 
 static int lua_st_voice_physical_trigger(lua_State* L) {
     int voiceNum = luaL_checkinteger(L, 1);
+    syncVoiceState();
     st_voice_physical_trigger(voiceNum);
     return 0;
 }
@@ -1494,6 +2212,7 @@ static int lua_st_voice_physical_trigger(lua_State* L) {
 
 static int lua_st_voices_start(lua_State* L) {
     LOG_DEBUG("lua_st_voices_start: called");
+    syncVoiceState();
     st_voices_start();
     LOG_DEBUG("lua_st_voices_start: returned from C function");
     return 0;
@@ -1501,12 +2220,14 @@ static int lua_st_voices_start(lua_State* L) {
 
 static int lua_st_voice_wait(lua_State* L) {
     float beats = luaL_checknumber(L, 1);
+    syncVoiceState();
     st_voice_wait(beats);
     return 0;
 }
 
 static int lua_st_voice_wait_beats(lua_State* L) {
     float beats = luaL_checknumber(L, 1);
+    syncVoiceState();
     st_voice_wait(beats);
     return 0;
 }
@@ -1515,6 +2236,7 @@ static int lua_st_voices_set_tempo(lua_State* L) {
     LOG_DEBUG("lua_st_voices_set_tempo: called");
     float bpm = luaL_checknumber(L, 1);
     LOG_DEBUGF("lua_st_voices_set_tempo: got bpm=%.1f", bpm);
+    syncVoiceState();
     st_voices_set_tempo(bpm);
     LOG_DEBUG("lua_st_voices_set_tempo: returned from C function");
     return 0;
@@ -1523,28 +2245,327 @@ static int lua_st_voices_set_tempo(lua_State* L) {
 static int lua_st_voices_end_slot(lua_State* L) {
     int slot = luaL_checkinteger(L, 1);
     float volume = luaL_checknumber(L, 2);
+    syncVoiceState();
     st_voices_end_slot(slot, volume);
     return 0;
 }
 
 static int lua_st_voices_next_slot(lua_State* L) {
     float volume = luaL_checknumber(L, 1);
+    syncVoiceState();
     uint32_t soundId = st_voices_next_slot(volume);
     lua_pushinteger(L, soundId);
     return 1;
 }
 
 static int lua_st_voices_end_play(lua_State* L) {
+    syncVoiceState();
     st_voices_end_play();
     return 0;
 }
 
 static int lua_st_voices_end_save(lua_State* L) {
     const char* filename = luaL_checkstring(L, 1);
+    syncVoiceState();
     st_voices_end_save(filename);
     return 0;
 }
 
+static int lua_st_voices_end_save_async(lua_State* L) {
+    std::string filename = luaL_checkstring(L, 1);
+    syncVoiceState();
+
+    int jobId = startRenderJob([filename]() -> int64_t {
+        st_voices_end_save(filename.c_str());
+        return 1;
+    });
+    lua_pushinteger(L, jobId);
+    return 1;
+}
+
+// Timeline events: the *_at bindings place a parameter change at an absolute
+// beat inside the current VOICES timeline. The renderer applies them at the
+// exact sample, so scripts can lay out a passage without voice_wait calls.
+static int lua_st_voice_waveform_at(lua_State* L) {
+    int voice = luaL_checkinteger(L, 1);
+    float beat = luaL_checknumber(L, 2);
+    int waveform = luaL_checkinteger(L, 3);
+    syncVoiceState();
+    st_voice_waveform_at(voice, beat, waveform);
+    return 0;
+}
+
+static int lua_st_voice_envelope_at(lua_State* L) {
+    int voice = luaL_checkinteger(L, 1);
+    float beat = luaL_checknumber(L, 2);
+    float attack = luaL_checknumber(L, 3);
+    float decay = luaL_checknumber(L, 4);
+    float sustain = luaL_checknumber(L, 5);
+    float release = luaL_checknumber(L, 6);
+    syncVoiceState();
+    st_voice_envelope_at(voice, beat, attack, decay, sustain, release);
+    return 0;
+}
+
+static int lua_st_voice_frequency_at(lua_State* L) {
+    int voice = luaL_checkinteger(L, 1);
+    float beat = luaL_checknumber(L, 2);
+    float frequency = luaL_checknumber(L, 3);
+    syncVoiceState();
+    st_voice_frequency_at(voice, beat, frequency);
+    return 0;
+}
+
+static int lua_st_voice_volume_at(lua_State* L) {
+    int voice = luaL_checkinteger(L, 1);
+    float beat = luaL_checknumber(L, 2);
+    float volume = luaL_checknumber(L, 3);
+    syncVoiceState();
+    st_voice_volume_at(voice, beat, volume);
+    return 0;
+}
+
+static int lua_st_voice_pan_at(lua_State* L) {
+    int voice = luaL_checkinteger(L, 1);
+    float beat = luaL_checknumber(L, 2);
+    float pan = luaL_checknumber(L, 3);
+    syncVoiceState();
+    st_voice_pan_at(voice, beat, pan);
+    return 0;
+}
+
+static int lua_st_voice_gate_at(lua_State* L) {
+    int voice = luaL_checkinteger(L, 1);
+    float beat = luaL_checknumber(L, 2);
+    int gate = luaL_checkinteger(L, 3);
+    syncVoiceState();
+    st_voice_gate_at(voice, beat, gate);
+    return 0;
+}
+
+static int lua_st_voice_filter_at(lua_State* L) {
+    int voice = luaL_checkinteger(L, 1);
+    float beat = luaL_checknumber(L, 2);
+    float cutoff = luaL_checknumber(L, 3);
+    float resonance = luaL_checknumber(L, 4);
+    int type = luaL_checkinteger(L, 5);
+    syncVoiceState();
+    st_voice_filter_at(voice, beat, cutoff, resonance, type);
+    return 0;
+}
+
+// Parse a note name such as "C4", "F#3" or "Bb2" into a frequency in Hz.
+// Returns false if the token is not a note.
+static bool parseNoteFrequency(const std::string& token, float& frequency) {
+    static const int semitones[7] = {9, 11, 0, 2, 4, 5, 7};  // A B C D E F G
+
+    if (token.empty()) {
+        return false;
+    }
+    char letter = toupper((unsigned char)token[0]);
+    if (letter < 'A' || letter > 'G') {
+        return false;
+    }
+    int semitone = semitones[letter - 'A'];
+
+    size_t pos = 1;
+    if (pos < token.size() && token[pos] == '#') {
+        semitone++;
+        pos++;
+    } else if (pos < token.size() && token[pos] == 'b') {
+        semitone--;
+        pos++;
+    }
+
+    if (pos >= token.size()) {
+        return false;
+    }
+    char* end = nullptr;
+    long octave = strtol(token.c_str() + pos, &end, 10);
+    if (*end != '\0') {
+        return false;
+    }
+
+    int midiNote = (int)(octave + 1) * 12 + semitone;
+    frequency = 440.0f * powf(2.0f, (midiNote - 69) / 12.0f);
+    return true;
+}
+
+// voice_sequence_at(voice, beat, step, notes)
+// Schedules a whole phrase in one call. notes is a space separated list of
+// note names, "-" for a rest and "_" to hold the previous note for another
+// step, e.g. "C4 E4 G4 _ C5 - G4 -". Each note becomes a frequency change
+// plus gate on/off pair in the timeline. Returns the beat after the phrase.
+static int lua_st_voice_sequence_at(lua_State* L) {
+    int voice = luaL_checkinteger(L, 1);
+    float beat = luaL_checknumber(L, 2);
+    float step = luaL_checknumber(L, 3);
+    const char* notes = luaL_checkstring(L, 4);
+
+    if (step <= 0.0f) {
+        return luaL_error(L, "voice_sequence_at: step must be > 0");
+    }
+
+    syncVoiceState();
+
+    // Release slightly before the next step so repeated notes retrigger
+    const float gateFraction = 0.9f;
+
+    float noteStart = 0.0f;
+    int noteSteps = 0;
+    auto closeNote = [&]() {
+        if (noteSteps > 0) {
+            st_voice_gate_at(voice, noteStart + step * (noteSteps - 1 + gateFraction), 0);
+            noteSteps = 0;
+        }
+    };
+
+    float cursor = beat;
+    const char* p = notes;
+    while (*p) {
+        while (*p == ' ' || *p == '\t') p++;
+        if (!*p) break;
+        const char* tokenStart = p;
+        while (*p && *p != ' ' && *p != '\t') p++;
+        std::string token(tokenStart, p - tokenStart);
+
+        if (token == "_") {
+            if (noteSteps > 0) {
+                noteSteps++;
+            }
+        } else if (token == "-") {
+            closeNote();
+        } else {
+            float frequency = 0.0f;
+            if (!parseNoteFrequency(token, frequency)) {
+                return luaL_error(L, "voice_sequence_at: invalid note '%s'", token.c_str());
+            }
+            closeNote();
+            st_voice_frequency_at(voice, cursor, frequency);
+            st_voice_gate_at(voice, cursor, 1);
+            noteStart = cursor;
+            noteSteps = 1;
+        }
+        cursor += step;
+    }
+    closeNote();
+
+    lua_pushnumber(L, cursor);
+    return 1;
+}
+
+// CPU seconds used by the calling thread; the offline render runs on it
+static double threadCpuSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Render `voices` sustained voices for `seconds` of audio on the VOICES
+// timeline and return the CPU time the render took
+static double benchmarkRender(int voices, float seconds, int effects) {
+    st_voices_start();
+    st_voices_set_tempo(60.0f);  // One beat per second
+    st_voice_set_filter_enabled((effects & 1) ? 1 : 0);
+
+    for (int v = 1; v <= voices; v++) {
+        st_voice_set_waveform(v, (effects & 4) ? 7 : 3);  // WAVE_PHYSICAL / WAVE_SAWTOOTH
+        st_voice_set_frequency(v, 110.0f * (1.0f + 0.25f * (v - 1)));
+        st_voice_set_envelope(v, 5.0f, 50.0f, 0.8f, 100.0f);
+        st_voice_set_volume(v, 1.0f / voices);
+        st_voice_set_delay_enable(v, (effects & 2) ? 1 : 0);
+        if (effects & 2) {
+            st_voice_set_delay_time(v, 0.25f);
+            st_voice_set_delay_feedback(v, 0.4f);
+            st_voice_set_delay_mix(v, 0.3f);
+        }
+        if (effects & 4) {
+            st_voice_set_physical_model(v, 0);
+            st_voice_physical_trigger(v);
+        }
+        st_voice_set_gate(v, 1);
+    }
+    st_voice_wait(seconds);
+    for (int v = 1; v <= voices; v++) {
+        st_voice_set_gate(v, 0);
+    }
+
+    double start = threadCpuSeconds();
+    uint32_t soundId = st_voices_next_slot(0.0f);
+    double elapsed = threadCpuSeconds() - start;
+
+    if (soundId != 0) {
+        st_sound_free_id(soundId);
+    }
+    return elapsed;
+}
+
+// voice_benchmark(voices, seconds [, effects])
+// Renders a timeline of `voices` sustained voices for `seconds` of audio
+// offline and measures the CPU time of the render, so the cost of the synth
+// can be measured without the audio callback or a window. effects is a
+// bitmask: 1 = global filter, 2 = per-voice delay, 4 = physical model.
+// Each requested effect is also rendered on its own against a plain
+// baseline to isolate its cost. The voices are borrowed: the settings the
+// script made through the voice bindings are put back afterwards.
+// Returns the realtime factor of the full render (audio seconds per CPU
+// second); voice_benchmark_cost(kind) then gives the CPU microseconds per
+// voice per audio second of kind 0 = plain voice, 1 = filter, 2 = delay,
+// 3 = physical model (0 for effects not requested).
+static double s_voiceBenchmarkCost[4] = {0.0, 0.0, 0.0, 0.0};
+
+static int lua_st_voice_benchmark(lua_State* L) {
+    int voices = luaL_checkinteger(L, 1);
+    float seconds = luaL_checknumber(L, 2);
+    int effects = luaL_optinteger(L, 3, 0);
+
+    if (voices < 1 || voices > 8) {
+        return luaL_error(L, "voice_benchmark: voices must be between 1 and 8");
+    }
+    if (seconds <= 0.0f) {
+        return luaL_error(L, "voice_benchmark: seconds must be > 0");
+    }
+
+    syncVoiceState();
+
+    double voiceSeconds = voices * (double)seconds;
+    double full = benchmarkRender(voices, seconds, effects);
+    double baseline = effects ? benchmarkRender(voices, seconds, 0) : full;
+    double effectCost[3] = {0.0, 0.0, 0.0};
+    for (int bit = 0; bit < 3; bit++) {
+        if (effects & (1 << bit)) {
+            double withEffect = benchmarkRender(voices, seconds, 1 << bit);
+            effectCost[bit] = std::max(0.0, withEffect - baseline) * 1e6 / voiceSeconds;
+        }
+    }
+
+    voiceShadowRestore();
+
+    double realtimeFactor = full > 0.0 ? seconds / full : 0.0;
+    double usPerVoiceSecond = baseline * 1e6 / voiceSeconds;
+    LOG_INFOF("voice_benchmark: %d voices, %.1fs audio, effects=%d: %.3fs CPU, %.1fx realtime, "
+              "%.1f us/voice/s plain, filter %.1f, delay %.1f, physical %.1f",
+              voices, seconds, effects, full, realtimeFactor, usPerVoiceSecond,
+              effectCost[0], effectCost[1], effectCost[2]);
+
+    s_voiceBenchmarkCost[0] = usPerVoiceSecond;
+    for (int bit = 0; bit < 3; bit++) {
+        s_voiceBenchmarkCost[bit + 1] = effectCost[bit];
+    }
+
+    lua_pushnumber(L, realtimeFactor);
+    return 1;
+}
+
+static int lua_st_voice_benchmark_cost(lua_State* L) {
+    int kind = luaL_checkinteger(L, 1);
+    if (kind < 0 || kind > 3) {
+        return luaL_error(L, "voice_benchmark_cost: kind must be between 0 and 3");
+    }
+    lua_pushnumber(L, s_voiceBenchmarkCost[kind]);
+    return 1;
+}
+
 // =============================================================================
 // Input API Bindings
 // =============================================================================
@@ -1594,6 +2615,8 @@ static int lua_st_basic_input_at(lua_State* L) {
     int x = luaL_checkinteger(L, 1);
     int y = luaL_checkinteger(L, 2);
     std::string prompt = "";
+
+    flushVoiceParameters();
     if (lua_gettop(L) > 2 && !lua_isnil(L, 3)) {
         prompt = luaL_checkstring(L, 3);
     }
@@ -1801,16 +2824,163 @@ static int lua_st_mouse_button_just_released(lua_State* L) {
 // Random Number Generation
 // =============================================================================
 
-static int lua_st_rand(lua_State* L) {
-    int n = luaL_checkinteger(L, 1);
-    if (n < 0) {
-        lua_pushinteger(L, 0);
-        return 1;
+// Each Lua state owns one xoshiro256** generator, stored as a userdata
+// upvalue on the RNG closures (basic_rnd, st_rand, st_rand_seed,
+// st_rand_fill, math.random, math.randomseed). Scripts no longer share the C library's global rand()
+// state, and a given seed replays the same sequence on every platform.
+struct BasicRandom {
+    uint64_t s[4];
+};
+
+static uint64_t basicRandomSplitMix(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void basicRandomSeed(BasicRandom* rng, uint64_t seed) {
+    for (int i = 0; i < 4; i++) {
+        rng->s[i] = basicRandomSplitMix(seed);
+    }
+}
+
+static inline uint64_t basicRandomRotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static inline uint64_t basicRandomNext(BasicRandom* rng) {
+    uint64_t* s = rng->s;
+    const uint64_t result = basicRandomRotl(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = basicRandomRotl(s[3], 45);
+    return result;
+}
+
+// Uniform double in [0, 1) from the top 53 bits
+static inline double basicRandomDouble(BasicRandom* rng) {
+    return (double)(basicRandomNext(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Unbiased integer in 0..n inclusive (Lemire's multiply-and-reject)
+static inline uint32_t basicRandomRange(BasicRandom* rng, uint32_t n) {
+    uint64_t range = (uint64_t)n + 1;
+    if (range > 0xFFFFFFFFULL) {
+        return (uint32_t)(basicRandomNext(rng) >> 32);
+    }
+    uint64_t m = (basicRandomNext(rng) >> 32) * range;
+    uint32_t low = (uint32_t)m;
+    if (low < (uint32_t)range) {
+        uint32_t threshold = (uint32_t)(-(uint32_t)range) % (uint32_t)range;
+        while (low < threshold) {
+            m = (basicRandomNext(rng) >> 32) * range;
+            low = (uint32_t)m;
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
+
+// Unbiased integer in 0..n inclusive over the full 64-bit range
+static inline uint64_t basicRandomRange64(BasicRandom* rng, uint64_t n) {
+    if (n == UINT64_MAX) {
+        return basicRandomNext(rng);
+    }
+    uint64_t range = n + 1;
+    __uint128_t m = (__uint128_t)basicRandomNext(rng) * range;
+    uint64_t low = (uint64_t)m;
+    if (low < range) {
+        uint64_t threshold = (0 - range) % range;
+        while (low < threshold) {
+            m = (__uint128_t)basicRandomNext(rng) * range;
+            low = (uint64_t)m;
+        }
+    }
+    return (uint64_t)(m >> 64);
+}
+
+static BasicRandom* basicRandomUpvalue(lua_State* L) {
+    return (BasicRandom*)lua_touserdata(L, lua_upvalueindex(1));
+}
+
+static int lua_st_rand(lua_State* L) {
+    int n = luaL_checkinteger(L, 1);
+    if (n < 0) {
+        lua_pushinteger(L, 0);
+        return 1;
+    }
+    // Generate random integer in range 0..n (inclusive)
+    lua_pushinteger(L, basicRandomRange(basicRandomUpvalue(L), (uint32_t)n));
+    return 1;
+}
+
+static int lua_st_rand_seed(lua_State* L) {
+    lua_Number seed = luaL_checknumber(L, 1);
+    basicRandomSeed(basicRandomUpvalue(L), (uint64_t)(int64_t)seed);
+    return 0;
+}
+
+// math.random / math.randomseed replacements so generated code that goes
+// through the Lua math library (RANDOMIZE, runtime helpers) shares the
+// same seeded stream as RND and RAND
+static int lua_math_random(lua_State* L) {
+    BasicRandom* rng = basicRandomUpvalue(L);
+    int nargs = lua_gettop(L);
+    if (nargs == 0) {
+        lua_pushnumber(L, basicRandomDouble(rng));
+        return 1;
+    }
+    lua_Integer low = 1;
+    lua_Integer high = luaL_checkinteger(L, 1);
+    if (nargs >= 2) {
+        low = high;
+        high = luaL_checkinteger(L, 2);
+    }
+    luaL_argcheck(L, low <= high, nargs, "interval is empty");
+    // Width and sum in unsigned 64-bit, so ranges of 2^32 and more (up to
+    // the whole lua_Integer range) neither truncate nor overflow
+    uint64_t width = (uint64_t)high - (uint64_t)low;
+    lua_pushinteger(L, (lua_Integer)((uint64_t)low + basicRandomRange64(rng, width)));
+    return 1;
+}
+
+static int lua_math_randomseed(lua_State* L) {
+    lua_Number seed = luaL_optnumber(L, 1, 0);
+    basicRandomSeed(basicRandomUpvalue(L), (uint64_t)(int64_t)seed);
+    return 0;
+}
+
+// st_rand_fill(array, count, max [, start])
+// Writes count values into array[start..start+count-1]. With max > 0 the
+// values are integers 0..max like RAND; with max <= 0 they are floats in
+// [0, 1) like RND. One call replaces a BASIC FOR loop of RND/RAND calls.
+static int lua_st_rand_fill(lua_State* L) {
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int count = luaL_checkinteger(L, 2);
+    int max = luaL_checkinteger(L, 3);
+    int start = luaL_optinteger(L, 4, 0);
+
+    if (count < 0) {
+        return luaL_error(L, "st_rand_fill: count must be >= 0");
     }
-    // Generate random integer in range 0..n (inclusive)
-    int result = rand() % (n + 1);
-    lua_pushinteger(L, result);
-    return 1;
+
+    BasicRandom* rng = basicRandomUpvalue(L);
+    if (max > 0) {
+        for (int i = 0; i < count; i++) {
+            lua_pushinteger(L, basicRandomRange(rng, (uint32_t)max));
+            lua_rawseti(L, 1, start + i);
+        }
+    } else {
+        for (int i = 0; i < count; i++) {
+            lua_pushnumber(L, basicRandomDouble(rng));
+            lua_rawseti(L, 1, start + i);
+        }
+    }
+    return 0;
 }
 
 // =============================================================================
@@ -1819,18 +2989,24 @@ static int lua_st_rand(lua_State* L) {
 
 static int lua_st_wait_frame(lua_State* L) {
     (void)L;
+    flushVoiceParameters();
+    pumpAssetPrefetch();
     st_wait_frame();
     return 0;
 }
 
 static int lua_st_wait_frames(lua_State* L) {
     int count = luaL_checkinteger(L, 1);
+    flushVoiceParameters();
+    pumpAssetPrefetch();
     st_wait_frames(count);
     return 0;
 }
 
 static int lua_st_wait_ms(lua_State* L) {
     int milliseconds = luaL_checkinteger(L, 1);
+    flushVoiceParameters();
+    pumpAssetPrefetch();
     st_wait_ms(milliseconds);
     return 0;
 }
@@ -1838,6 +3014,8 @@ static int lua_st_wait_ms(lua_State* L) {
 static int lua_st_wait(lua_State* L) {
     float seconds = luaL_checknumber(L, 1);
     int frames = (int)(seconds * 60.0f);  // Assume 60 FPS
+    flushVoiceParameters();
+    pumpAssetPrefetch();
     for (int i = 0; i < frames; i++) {
         st_wait_frame();
     }
@@ -3739,6 +4917,42 @@ static int lua_sprite_explode_directional(lua_State* L) {
     return 1;
 }
 
+// Explosion presets used by SPRITE_EXPLODE_MODE and SPRITE_EXPLODE_RANGE.
+// Index 0 is unused so the table lines up with the BASIC mode numbers (1-6).
+struct ExplodePreset {
+    bool directional;
+    uint16_t fragments;
+    float a;    // force (advanced) or force_x (directional)
+    float b;    // gravity (advanced) or force_y (directional)
+    float fade; // fade time (advanced only)
+};
+
+static const ExplodePreset s_explodePresets[7] = {
+    {false,   0,   0.0f,    0.0f, 0.0f},
+    {false,  48, 200.0f,  100.0f, 2.0f},  // 1: BASIC_EXPLOSION
+    {false, 128, 350.0f,   80.0f, 3.0f},  // 2: MASSIVE_BLAST
+    {false,  64, 120.0f,   40.0f, 4.0f},  // 3: GENTLE_DISPERSAL
+    {true,   80, 180.0f,  -30.0f, 0.0f},  // 4: RIGHTWARD_BLAST
+    {true,   96,   0.0f, -250.0f, 0.0f},  // 5: UPWARD_ERUPTION
+    {false,  32, 400.0f,  200.0f, 1.0f},  // 6: RAPID_BURST
+};
+
+// Upper bound on fragments spawned by a single SPRITE_EXPLODE_RANGE call.
+// Blowing up a whole wave of sprites with MASSIVE_BLAST used to spawn
+// 128 fragments each in one frame; the range call scales every sprite's
+// share down evenly instead. Every sprite still gets at least one fragment,
+// so a range longer than the budget spawns one fragment per sprite.
+// 0 disables the cap. Reset to the default when a script starts.
+static const int EXPLODE_DEFAULT_FRAGMENT_BUDGET = 2048;
+static int s_explodeFragmentBudget = EXPLODE_DEFAULT_FRAGMENT_BUDGET;
+
+static bool explodeWithPreset(uint16_t spriteId, const ExplodePreset& preset, uint16_t fragments) {
+    if (preset.directional) {
+        return sprite_explode_directional(spriteId, fragments, preset.a, preset.b);
+    }
+    return sprite_explode_advanced(spriteId, fragments, preset.a, preset.b, preset.fade);
+}
+
 static int lua_sprite_explode_mode(lua_State* L) {
     int sprite_id = luaL_checkinteger(L, 1);
     int explosion_mode = luaL_checkinteger(L, 2);
@@ -3753,53 +4967,105 @@ static int lua_sprite_explode_mode(lua_State* L) {
         return luaL_error(L, "sprite_explode_mode: explosion_mode must be between 1 and 6");
     }
 
-    bool success = false;
+    const ExplodePreset& preset = s_explodePresets[explosion_mode];
+    bool success = explodeWithPreset((uint16_t)sprite_id, preset, preset.fragments);
 
-    // Apply the appropriate explosion mode
-    switch (explosion_mode) {
-        case 1: // BASIC_EXPLOSION
-            success = sprite_explode_advanced((uint16_t)sprite_id, 48, 200.0f, 100.0f, 2.0f);
-            break;
-        case 2: // MASSIVE_BLAST
-            success = sprite_explode_advanced((uint16_t)sprite_id, 128, 350.0f, 80.0f, 3.0f);
-            break;
-        case 3: // GENTLE_DISPERSAL
-            success = sprite_explode_advanced((uint16_t)sprite_id, 64, 120.0f, 40.0f, 4.0f);
-            break;
-        case 4: // RIGHTWARD_BLAST
-            success = sprite_explode_directional((uint16_t)sprite_id, 80, 180.0f, -30.0f);
-            break;
-        case 5: // UPWARD_ERUPTION
-            success = sprite_explode_directional((uint16_t)sprite_id, 96, 0.0f, -250.0f);
-            break;
-        case 6: // RAPID_BURST
-            success = sprite_explode_advanced((uint16_t)sprite_id, 32, 400.0f, 200.0f, 1.0f);
-            break;
-        default:
-            return luaL_error(L, "sprite_explode_mode: invalid explosion_mode");
+    lua_pushboolean(L, success);
+    return 1;
+}
+
+static int lua_sprite_explode_range(lua_State* L) {
+    int first_id = luaL_checkinteger(L, 1);
+    int last_id = luaL_checkinteger(L, 2);
+    int explosion_mode = luaL_checkinteger(L, 3);
+
+    if (first_id < 1 || last_id > 1024 || first_id > last_id) {
+        return luaL_error(L, "sprite_explode_range: sprite ids must satisfy 1 <= first <= last <= 1024");
     }
 
-    lua_pushboolean(L, success);
+    if (explosion_mode < 1 || explosion_mode > 6) {
+        return luaL_error(L, "sprite_explode_range: explosion_mode must be between 1 and 6");
+    }
+
+    const ExplodePreset& preset = s_explodePresets[explosion_mode];
+    int spriteCount = last_id - first_id + 1;
+
+    // Split the budget evenly; the first (budget % count) sprites get one
+    // extra fragment so the total is exact and the result is independent
+    // of call timing. A range longer than the budget gets one fragment per
+    // sprite, so every sprite in it still explodes.
+    int perSprite = preset.fragments;
+    int remainder = 0;
+    if (s_explodeFragmentBudget > 0 && spriteCount * perSprite > s_explodeFragmentBudget) {
+        perSprite = s_explodeFragmentBudget / spriteCount;
+        remainder = s_explodeFragmentBudget % spriteCount;
+        if (perSprite < 1) {
+            perSprite = 1;
+            remainder = 0;
+        }
+    }
+
+    int exploded = 0;
+    for (int i = 0; i < spriteCount; i++) {
+        int fragments = perSprite + (i < remainder ? 1 : 0);
+        if (explodeWithPreset((uint16_t)(first_id + i), preset, (uint16_t)fragments)) {
+            exploded++;
+        }
+    }
+
+    lua_pushinteger(L, exploded);
     return 1;
 }
 
+static int lua_sprite_explode_set_budget(lua_State* L) {
+    int budget = luaL_checkinteger(L, 1);
+    if (budget < 0) {
+        return luaL_error(L, "sprite_explode_set_budget: budget must be >= 0");
+    }
+    s_explodeFragmentBudget = budget;
+    return 0;
+}
+
 // =============================================================================
 // Asset Management API Bindings
 // =============================================================================
 
+// Sorted asset names per type, rebuilt lazily after the database changes
+// (see Asset Name Index below)
+struct AssetNameIndex {
+    std::vector<std::string> names;
+    std::vector<std::pair<std::string, size_t>> folded;  // lowercased name, index into names
+};
+
+static std::map<int, AssetNameIndex> s_assetNameIndex;
+
+static void invalidateAssetNameIndex() {
+    s_assetNameIndex.clear();
+}
+
+// Defined with the residency tables and prefetch queues below
+static void assetResidencyReset();
+static void prefetchReset();
+
 // Initialization
 static int lua_st_asset_init(lua_State* L) {
     const char* db_path = luaL_checkstring(L, 1);
     size_t max_cache_size = luaL_optinteger(L, 2, 0);
 
+    prefetchReset();
+    assetResidencyReset();
     bool result = st_asset_init(db_path, max_cache_size);
+    invalidateAssetNameIndex();
     lua_pushboolean(L, result);
     return 1;
 }
 
 static int lua_st_asset_shutdown(lua_State* L) {
     (void)L;
+    prefetchReset();
+    assetResidencyReset();
     st_asset_shutdown();
+    invalidateAssetNameIndex();
     return 0;
 }
 
@@ -3810,11 +5076,555 @@ static int lua_st_asset_is_initialized(lua_State* L) {
     return 1;
 }
 
+// =============================================================================
+// Asset Residency - per-type budgets with segmented LRU eviction
+// =============================================================================
+//
+// Assets loaded through these bindings stay resident (no st_asset_unload)
+// until their type exceeds its byte budget. Each type keeps two LRU lists:
+// new loads enter the probationary segment and move to the protected one on
+// their second use, so a one-off scan (a music import, a DIR of every sprite)
+// only churns probation and never evicts the working set. Eviction takes
+// probation's least recent entry first. A budget of 0 means unlimited.
+//
+// Loading a resident name again hands out the same ID and counts another
+// holder. ASSET_UNLOAD drops a holder; when the last one lets go the asset
+// stays resident with no holders, so a later load is still a hit. Only
+// assets with no holders are evicted; held or pinned assets and assets with
+// live views never are, and a type whose remaining assets are all in use
+// runs over its budget. The tables belong to the script thread; the REPL's
+// ASSET STATS reads a copy of the per-type counters published once per
+// frame.
+
+static const double ASSET_PROTECTED_FRACTION = 0.8;
+
+// Live asset views pin their asset: an unload requested while a view is
+// still reachable is deferred until the last view is collected.
+static std::unordered_map<STAssetID, int> s_assetViewPins;
+static std::unordered_map<STAssetID, bool> s_assetDeferredUnload;
+
+struct AssetTypeCache {
+    size_t budget = 0;
+    size_t bytes = 0;
+    size_t protectedBytes = 0;
+    std::list<STAssetID> probation;      // front = most recent
+    std::list<STAssetID> protectedList;  // front = most recent
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+};
+
+struct AssetResidency {
+    std::string name;
+    int type;
+    size_t bytes;
+    bool isProtected;
+    int pins;
+    int holders;
+    std::list<STAssetID>::iterator position;
+};
+
+static std::map<int, AssetTypeCache> s_assetTypeCaches;
+static std::unordered_map<STAssetID, AssetResidency> s_assetResidency;
+static std::unordered_map<std::string, STAssetID> s_assetResidentByName;
+
+static bool assetIsPinned(const AssetResidency& entry, STAssetID asset) {
+    auto view = s_assetViewPins.find(asset);
+    return entry.pins > 0 || (view != s_assetViewPins.end() && view->second > 0);
+}
+
+static bool assetIsEvictable(const AssetResidency& entry, STAssetID asset) {
+    return entry.holders == 0 && !assetIsPinned(entry, asset);
+}
+
+static void assetForget(STAssetID asset) {
+    auto it = s_assetResidency.find(asset);
+    if (it == s_assetResidency.end()) {
+        return;
+    }
+    AssetTypeCache& cache = s_assetTypeCaches[it->second.type];
+    if (it->second.isProtected) {
+        cache.protectedList.erase(it->second.position);
+        cache.protectedBytes -= it->second.bytes;
+    } else {
+        cache.probation.erase(it->second.position);
+    }
+    cache.bytes -= it->second.bytes;
+    s_assetResidentByName.erase(it->second.name);
+    s_assetResidency.erase(it);
+}
+
+// Evict the least recent unheld, unpinned entry of a segment; false if none
+// could go
+static bool assetEvictFrom(AssetTypeCache& cache, std::list<STAssetID>& segment) {
+    for (auto it = segment.rbegin(); it != segment.rend(); ++it) {
+        STAssetID victim = *it;
+        if (assetIsEvictable(s_assetResidency[victim], victim)) {
+            assetForget(victim);
+            st_asset_unload(victim);
+            cache.evictions++;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void assetEnforceBudget(AssetTypeCache& cache) {
+    if (cache.budget == 0) {
+        return;
+    }
+    while (cache.bytes > cache.budget) {
+        if (!assetEvictFrom(cache, cache.probation) &&
+            !assetEvictFrom(cache, cache.protectedList)) {
+            break;  // everything left is held or pinned
+        }
+    }
+}
+
+// Promote to the protected segment, demoting its oldest entries to keep it
+// within its share of the budget
+static void assetTouch(STAssetID asset) {
+    AssetResidency& entry = s_assetResidency[asset];
+    AssetTypeCache& cache = s_assetTypeCaches[entry.type];
+    cache.hits++;
+
+    if (entry.isProtected) {
+        cache.protectedList.splice(cache.protectedList.begin(), cache.protectedList, entry.position);
+        return;
+    }
+
+    cache.probation.erase(entry.position);
+    cache.protectedList.push_front(asset);
+    entry.position = cache.protectedList.begin();
+    entry.isProtected = true;
+    cache.protectedBytes += entry.bytes;
+
+    size_t protectedLimit = (size_t)(cache.budget * ASSET_PROTECTED_FRACTION);
+    while (cache.budget > 0 && cache.protectedBytes > protectedLimit && cache.protectedList.size() > 1) {
+        STAssetID demoted = cache.protectedList.back();
+        AssetResidency& oldest = s_assetResidency[demoted];
+        cache.protectedList.pop_back();
+        cache.protectedBytes -= oldest.bytes;
+        cache.probation.push_front(demoted);
+        oldest.position = cache.probation.begin();
+        oldest.isProtected = false;
+    }
+}
+
+static void assetTrack(STAssetID asset, const char* name) {
+    if (!asset) {
+        return;
+    }
+    auto tracked = s_assetResidency.find(asset);
+    if (tracked != s_assetResidency.end()) {
+        tracked->second.holders++;   // The Framework handed back an ID we already track
+        return;
+    }
+    int type = st_asset_get_type(asset);
+    AssetTypeCache& cache = s_assetTypeCaches[type];
+    cache.misses++;
+
+    AssetResidency entry;
+    entry.name = name ? name : "";
+    entry.type = type;
+    entry.bytes = st_asset_get_size(asset);
+    entry.isProtected = false;
+    entry.pins = 0;
+    entry.holders = 1;
+    cache.probation.push_front(asset);
+    entry.position = cache.probation.begin();
+    cache.bytes += entry.bytes;
+
+    if (!entry.name.empty()) {
+        s_assetResidentByName[entry.name] = asset;
+    }
+    s_assetResidency[asset] = entry;
+    assetEnforceBudget(cache);
+}
+
+// Per-type counters as last published by the script thread
+struct AssetTypeStats {
+    size_t budget;
+    size_t bytes;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+};
+
+static std::mutex s_assetStatsMutex;
+static std::map<int, AssetTypeStats> s_assetStatsSnapshot;   // guarded by s_assetStatsMutex
+
+static void assetPublishStats() {
+    std::map<int, AssetTypeStats> stats;
+    for (const auto& pair : s_assetTypeCaches) {
+        const AssetTypeCache& cache = pair.second;
+        stats[pair.first] = {cache.budget, cache.bytes, cache.hits, cache.misses, cache.evictions};
+    }
+    std::lock_guard<std::mutex> lock(s_assetStatsMutex);
+    s_assetStatsSnapshot.swap(stats);
+}
+
+static void assetResidencyReset() {
+    // Assets nobody holds are resident only for the cache's sake
+    if (st_asset_is_initialized()) {
+        for (const auto& pair : s_assetResidency) {
+            if (pair.second.holders > 0) {
+                continue;
+            }
+            auto view = s_assetViewPins.find(pair.first);
+            if (view != s_assetViewPins.end() && view->second > 0) {
+                s_assetDeferredUnload[pair.first] = true;
+            } else {
+                st_asset_unload(pair.first);
+            }
+        }
+    }
+    for (auto& pair : s_assetTypeCaches) {
+        pair.second.probation.clear();
+        pair.second.protectedList.clear();
+        pair.second.bytes = 0;
+        pair.second.protectedBytes = 0;
+    }
+    s_assetResidency.clear();
+    s_assetResidentByName.clear();
+    assetPublishStats();
+}
+
+static const char* assetTypeName(int type) {
+    switch (type) {
+        case ST_ASSET_IMAGE:  return "Images";
+        case ST_ASSET_SOUND:  return "Sounds";
+        case ST_ASSET_MUSIC:  return "Music";
+        case ST_ASSET_FONT:   return "Fonts";
+        case ST_ASSET_SPRITE: return "Sprites";
+        case ST_ASSET_DATA:   return "Data";
+        default:              return "Other";
+    }
+}
+
+std::vector<std::string> assetCacheReport() {
+    std::map<int, AssetTypeStats> stats;
+    {
+        std::lock_guard<std::mutex> lock(s_assetStatsMutex);
+        stats = s_assetStatsSnapshot;
+    }
+
+    std::vector<std::string> lines;
+    if (stats.empty()) {
+        lines.push_back("No assets loaded");
+        return lines;
+    }
+
+    char line[160];
+    snprintf(line, sizeof(line), "%-8s %10s %10s %8s %8s %9s",
+             "Type", "Resident", "Budget", "Hits", "Misses", "Evicted");
+    lines.push_back(line);
+    for (const auto& pair : stats) {
+        const AssetTypeStats& cache = pair.second;
+        std::string budget = cache.budget ? std::to_string(cache.budget / 1024) + "K" : "none";
+        snprintf(line, sizeof(line), "%-8s %9zuK %10s %8llu %8llu %9llu",
+                 assetTypeName(pair.first), cache.bytes / 1024, budget.c_str(),
+                 (unsigned long long)cache.hits, (unsigned long long)cache.misses,
+                 (unsigned long long)cache.evictions);
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+static int lua_st_asset_set_type_budget(lua_State* L) {
+    int type = luaL_checkinteger(L, 1);
+    lua_Integer bytes = luaL_checkinteger(L, 2);
+    if (bytes < 0) {
+        return luaL_error(L, "asset_set_type_budget: budget must be >= 0");
+    }
+    AssetTypeCache& cache = s_assetTypeCaches[type];
+    cache.budget = (size_t)bytes;
+    assetEnforceBudget(cache);
+    return 0;
+}
+
+static int lua_st_asset_pin(lua_State* L) {
+    STAssetID asset = luaL_checkinteger(L, 1);
+    auto it = s_assetResidency.find(asset);
+    if (it != s_assetResidency.end()) {
+        it->second.pins++;
+    }
+    lua_pushboolean(L, it != s_assetResidency.end());
+    return 1;
+}
+
+static int lua_st_asset_unpin(lua_State* L) {
+    STAssetID asset = luaL_checkinteger(L, 1);
+    auto it = s_assetResidency.find(asset);
+    if (it != s_assetResidency.end() && it->second.pins > 0) {
+        it->second.pins--;
+        if (it->second.pins == 0) {
+            assetEnforceBudget(s_assetTypeCaches[it->second.type]);
+        }
+    }
+    return 0;
+}
+
+static const AssetTypeCache* assetTypeCacheArg(lua_State* L) {
+    auto it = s_assetTypeCaches.find((int)luaL_checkinteger(L, 1));
+    return it != s_assetTypeCaches.end() ? &it->second : nullptr;
+}
+
+static int lua_st_asset_type_hits(lua_State* L) {
+    const AssetTypeCache* cache = assetTypeCacheArg(L);
+    lua_pushinteger(L, cache ? (lua_Integer)cache->hits : 0);
+    return 1;
+}
+
+static int lua_st_asset_type_misses(lua_State* L) {
+    const AssetTypeCache* cache = assetTypeCacheArg(L);
+    lua_pushinteger(L, cache ? (lua_Integer)cache->misses : 0);
+    return 1;
+}
+
+static int lua_st_asset_type_evictions(lua_State* L) {
+    const AssetTypeCache* cache = assetTypeCacheArg(L);
+    lua_pushinteger(L, cache ? (lua_Integer)cache->evictions : 0);
+    return 1;
+}
+
+static int lua_st_asset_type_bytes(lua_State* L) {
+    const AssetTypeCache* cache = assetTypeCacheArg(L);
+    lua_pushinteger(L, cache ? (lua_Integer)cache->bytes : 0);
+    return 1;
+}
+
+// asset.getTypeStats(type) -> resident bytes, budget, hits, misses, evictions
+static int lua_st_asset_get_type_stats(lua_State* L) {
+    const AssetTypeCache* cache = assetTypeCacheArg(L);
+    AssetTypeCache empty;
+    if (!cache) {
+        cache = &empty;
+    }
+    lua_pushinteger(L, (lua_Integer)cache->bytes);
+    lua_pushinteger(L, (lua_Integer)cache->budget);
+    lua_pushinteger(L, (lua_Integer)cache->hits);
+    lua_pushinteger(L, (lua_Integer)cache->misses);
+    lua_pushinteger(L, (lua_Integer)cache->evictions);
+    return 5;
+}
+
+// =============================================================================
+// Asset Prefetch
+// =============================================================================
+//
+// ASSET_PREFETCH name[, priority] gets an asset ready before the script asks
+// for it. Plain files (sprite sheets, WAV/ABC/SID, tilesets) are mapped and
+// paged in by a small worker pool, so the later *_load call reads from RAM.
+// Asset database entries are loaded on the script thread at frame boundaries,
+// a few milliseconds per frame, and the ID is handed to the next asset_load
+// of that name. Higher priority requests are served first.
+
+struct PrefetchRequest {
+    std::string name;
+    int priority;
+    uint64_t sequence;
+    size_t bytes;
+};
+
+struct PrefetchOrder {
+    bool operator()(const PrefetchRequest& a, const PrefetchRequest& b) const {
+        if (a.priority != b.priority) {
+            return a.priority < b.priority;
+        }
+        return a.sequence > b.sequence;
+    }
+};
+
+using PrefetchQueue = std::priority_queue<PrefetchRequest, std::vector<PrefetchRequest>, PrefetchOrder>;
+
+static const double PREFETCH_FRAME_BUDGET_MS = 4.0;
+
+static std::mutex s_prefetchMutex;
+static std::condition_variable s_prefetchWake;
+static PrefetchQueue s_prefetchFileQueue;          // guarded by s_prefetchMutex
+static std::atomic<int> s_prefetchFilesPending{0};
+static std::atomic<int64_t> s_prefetchBytesPending{0};
+static PrefetchQueue s_prefetchAssetQueue;         // script thread only
+static std::unordered_map<std::string, STAssetID> s_prefetchedAssets;
+static uint64_t s_prefetchSequence = 0;
+
+struct PrefetchPool {
+    std::vector<std::thread> workers;
+    bool stopping = false;
+
+    ~PrefetchPool() {
+        {
+            std::lock_guard<std::mutex> lock(s_prefetchMutex);
+            stopping = true;
+        }
+        s_prefetchWake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+};
+
+static PrefetchPool s_prefetchPool;
+
+// Map the file and touch one byte per page so the OS reads it in now
+static void prefetchWarmFile(const PrefetchRequest& request) {
+    MappedFile file;
+    if (file.open(request.name) && file.size() > 0) {
+        file.adviseSequential(0, file.size());
+        const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+        const uint8_t* data = file.data();
+        volatile uint8_t sink = 0;
+        for (size_t offset = 0; offset < file.size(); offset += page) {
+            sink ^= data[offset];
+        }
+        (void)sink;
+    }
+    s_prefetchBytesPending -= (int64_t)request.bytes;
+    s_prefetchFilesPending--;
+}
+
+static void prefetchWorker() {
+    for (;;) {
+        PrefetchRequest request;
+        {
+            std::unique_lock<std::mutex> lock(s_prefetchMutex);
+            s_prefetchWake.wait(lock, [] {
+                return s_prefetchPool.stopping || !s_prefetchFileQueue.empty();
+            });
+            if (s_prefetchPool.stopping) {
+                return;
+            }
+            request = s_prefetchFileQueue.top();
+            s_prefetchFileQueue.pop();
+        }
+        prefetchWarmFile(request);
+    }
+}
+
+static void prefetchQueueFile(const std::string& path, size_t bytes, int priority) {
+    std::lock_guard<std::mutex> lock(s_prefetchMutex);
+    if (s_prefetchPool.workers.empty()) {
+        unsigned int count = std::thread::hardware_concurrency() / 2;
+        count = std::max(1u, std::min(count, 4u));
+        for (unsigned int i = 0; i < count; i++) {
+            s_prefetchPool.workers.emplace_back(prefetchWorker);
+        }
+    }
+    s_prefetchFileQueue.push({path, priority, s_prefetchSequence++, bytes});
+    s_prefetchFilesPending++;
+    s_prefetchBytesPending += (int64_t)bytes;
+    s_prefetchWake.notify_one();
+}
+
+// Drop queued prefetches and release prefetched assets no ASSET_LOAD
+// claimed. Their IDs belong to the run (and database) that loaded them.
+static void prefetchReset() {
+    {
+        std::lock_guard<std::mutex> lock(s_prefetchMutex);
+        while (!s_prefetchFileQueue.empty()) {
+            s_prefetchBytesPending -= (int64_t)s_prefetchFileQueue.top().bytes;
+            s_prefetchFilesPending--;
+            s_prefetchFileQueue.pop();
+        }
+    }
+    s_prefetchAssetQueue = PrefetchQueue();
+
+    if (st_asset_is_initialized()) {
+        for (const auto& pair : s_prefetchedAssets) {
+            st_asset_unload(pair.second);
+        }
+    }
+    s_prefetchedAssets.clear();
+}
+
+void pumpAssetPrefetch() {
+    assetPublishStats();
+    if (s_prefetchAssetQueue.empty()) {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    while (!s_prefetchAssetQueue.empty()) {
+        PrefetchRequest request = s_prefetchAssetQueue.top();
+        s_prefetchAssetQueue.pop();
+
+        if (s_prefetchedAssets.find(request.name) == s_prefetchedAssets.end()) {
+            STAssetID asset = st_asset_load(request.name.c_str());
+            if (asset) {
+                s_prefetchedAssets[request.name] = asset;
+            }
+        }
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= PREFETCH_FRAME_BUDGET_MS) {
+            break;
+        }
+    }
+}
+
+static int lua_st_asset_prefetch(lua_State* L) {
+    const char* name = luaL_checkstring(L, 1);
+    int priority = luaL_optinteger(L, 2, 0);
+
+    struct stat st;
+    if (stat(name, &st) == 0 && S_ISREG(st.st_mode)) {
+        prefetchQueueFile(name, (size_t)st.st_size, priority);
+        lua_pushboolean(L, 1);
+        return 1;
+    }
+
+    if (st_asset_is_initialized() && st_asset_exists(name)) {
+        if (s_prefetchedAssets.find(name) == s_prefetchedAssets.end()) {
+            s_prefetchAssetQueue.push({name, priority, s_prefetchSequence++, 0});
+        }
+        lua_pushboolean(L, 1);
+        return 1;
+    }
+
+    lua_pushboolean(L, 0);
+    return 1;
+}
+
+static int lua_st_asset_prefetch_pending(lua_State* L) {
+    lua_pushinteger(L, s_prefetchFilesPending.load() + (int)s_prefetchAssetQueue.size());
+    return 1;
+}
+
+// Bytes of queued files not yet paged in (database entries are sized on load)
+static int lua_st_asset_prefetch_bytes(lua_State* L) {
+    lua_pushinteger(L, (lua_Integer)std::max<int64_t>(0, s_prefetchBytesPending.load()));
+    return 1;
+}
+
 // Loading/Unloading
 static int lua_st_asset_load(lua_State* L) {
     const char* name = luaL_checkstring(L, 1);
 
+    auto resident = s_assetResidentByName.find(name);
+    if (resident != s_assetResidentByName.end()) {
+        STAssetID asset = resident->second;
+        if (st_asset_is_loaded(name)) {
+            s_assetResidency[asset].holders++;
+            assetTouch(asset);
+            lua_pushinteger(L, asset);
+            return 1;
+        }
+        // The Framework evicted it on its own; load it afresh
+        assetForget(asset);
+    }
+
+    auto prefetched = s_prefetchedAssets.find(name);
+    if (prefetched != s_prefetchedAssets.end()) {
+        STAssetID asset = prefetched->second;
+        s_prefetchedAssets.erase(prefetched);
+        assetTrack(asset, name);
+        lua_pushinteger(L, asset);
+        return 1;
+    }
+
     STAssetID asset = st_asset_load(name);
+    assetTrack(asset, name);
     lua_pushinteger(L, asset);
     return 1;
 }
@@ -3824,12 +5634,26 @@ static int lua_st_asset_load_file(lua_State* L) {
     int type = luaL_checkinteger(L, 2);
 
     STAssetID asset = st_asset_load_file(path, (STAssetType)type);
+    assetTrack(asset, nullptr);
     lua_pushinteger(L, asset);
     return 1;
 }
 
 static int lua_st_asset_unload(lua_State* L) {
     STAssetID asset = luaL_checkinteger(L, 1);
+    auto resident = s_assetResidency.find(asset);
+    if (resident != s_assetResidency.end()) {
+        // The last holder leaves it resident and evictable
+        if (resident->second.holders > 0 && --resident->second.holders == 0) {
+            assetEnforceBudget(s_assetTypeCaches[resident->second.type]);
+        }
+        return 0;
+    }
+    auto pin = s_assetViewPins.find(asset);
+    if (pin != s_assetViewPins.end() && pin->second > 0) {
+        s_assetDeferredUnload[asset] = true;
+        return 0;
+    }
     st_asset_unload(asset);
     return 0;
 }
@@ -3849,6 +5673,7 @@ static int lua_st_asset_import(lua_State* L) {
     int type = luaL_optinteger(L, 3, -1);
 
     bool result = st_asset_import(file_path, asset_name, type);
+    invalidateAssetNameIndex();
     lua_pushboolean(L, result);
     return 1;
 }
@@ -3858,6 +5683,7 @@ static int lua_st_asset_import_directory(lua_State* L) {
     bool recursive = lua_toboolean(L, 2);
 
     int count = st_asset_import_directory(directory, recursive);
+    invalidateAssetNameIndex();
     lua_pushinteger(L, count);
     return 1;
 }
@@ -3875,6 +5701,7 @@ static int lua_st_asset_delete(lua_State* L) {
     const char* asset_name = luaL_checkstring(L, 1);
 
     bool result = st_asset_delete(asset_name);
+    invalidateAssetNameIndex();
     lua_pushboolean(L, result);
     return 1;
 }
@@ -3886,15 +5713,234 @@ static int lua_st_asset_get_data(lua_State* L) {
     const void* data = st_asset_get_data(asset);
     size_t size = st_asset_get_size(asset);
 
-    if (data && size > 0) {
-        lua_pushlstring(L, (const char*)data, size);
-        return 1;
+    if (data && size > 0) {
+        lua_pushlstring(L, (const char*)data, size);
+        return 1;
+    }
+
+    lua_pushnil(L);
+    return 1;
+}
+
+// =============================================================================
+// Asset Views - read-only windows onto asset store memory
+// =============================================================================
+//
+// asset.view(id [, offset, length]) returns a userdata that reads straight
+// from the bytes st_asset_get_data() exposes, so parsing a large DATA asset
+// never copies it into the Lua heap. The data pointer is re-resolved on each
+// access, so a view whose asset has been dropped from the cache raises an
+// error instead of reading freed memory. Offsets are 0-based, like PEEK.
+
+static const char* ASSET_VIEW_METATABLE = "FBRunner.AssetView";
+
+struct AssetView {
+    STAssetID asset;
+    size_t offset;
+    size_t length;
+};
+
+static AssetView* checkAssetView(lua_State* L, int index) {
+    return (AssetView*)luaL_checkudata(L, index, ASSET_VIEW_METATABLE);
+}
+
+// Resolve the view to a pointer and check that [at, at + count) lies inside it
+static const uint8_t* assetViewBytes(lua_State* L, AssetView* view, lua_Integer at, size_t count) {
+    const uint8_t* data = (const uint8_t*)st_asset_get_data(view->asset);
+    size_t size = st_asset_get_size(view->asset);
+    if (!data || view->offset + view->length > size) {
+        luaL_error(L, "asset view: asset %d is no longer loaded", (int)view->asset);
+        return nullptr;
+    }
+    if (at < 0 || (size_t)at > view->length || count > view->length - (size_t)at) {
+        luaL_error(L, "asset view: offset %d out of range (length %d)",
+                   (int)at, (int)view->length);
+        return nullptr;
+    }
+    return data + view->offset + at;
+}
+
+static void pushAssetView(lua_State* L, STAssetID asset, size_t offset, size_t length) {
+    AssetView* view = (AssetView*)lua_newuserdata(L, sizeof(AssetView));
+    view->asset = asset;
+    view->offset = offset;
+    view->length = length;
+    luaL_getmetatable(L, ASSET_VIEW_METATABLE);
+    lua_setmetatable(L, -2);
+    s_assetViewPins[asset]++;
+}
+
+static int lua_st_asset_view(lua_State* L) {
+    STAssetID asset = luaL_checkinteger(L, 1);
+    lua_Integer offset = luaL_optinteger(L, 2, 0);
+
+    const void* data = st_asset_get_data(asset);
+    size_t size = st_asset_get_size(asset);
+    if (!data || size == 0) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_Integer length = luaL_optinteger(L, 3, (lua_Integer)size - offset);
+    if (offset < 0 || length < 0 || (size_t)(offset + length) > size) {
+        return luaL_error(L, "asset.view: range %d+%d exceeds asset size %d",
+                          (int)offset, (int)length, (int)size);
+    }
+
+    pushAssetView(L, asset, (size_t)offset, (size_t)length);
+    return 1;
+}
+
+static int lua_asset_view_size(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    lua_pushinteger(L, (lua_Integer)view->length);
+    return 1;
+}
+
+static int lua_asset_view_byte(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    const uint8_t* p = assetViewBytes(L, view, luaL_checkinteger(L, 2), 1);
+    lua_pushinteger(L, p[0]);
+    return 1;
+}
+
+static int lua_asset_view_i8(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    const uint8_t* p = assetViewBytes(L, view, luaL_checkinteger(L, 2), 1);
+    lua_pushinteger(L, (int8_t)p[0]);
+    return 1;
+}
+
+// Multi-byte reads are little-endian, matching the asset file formats
+static int lua_asset_view_u16(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    const uint8_t* p = assetViewBytes(L, view, luaL_checkinteger(L, 2), 2);
+    lua_pushinteger(L, (uint16_t)(p[0] | (p[1] << 8)));
+    return 1;
+}
+
+static int lua_asset_view_i16(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    const uint8_t* p = assetViewBytes(L, view, luaL_checkinteger(L, 2), 2);
+    lua_pushinteger(L, (int16_t)(p[0] | (p[1] << 8)));
+    return 1;
+}
+
+static int lua_asset_view_u32(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    const uint8_t* p = assetViewBytes(L, view, luaL_checkinteger(L, 2), 4);
+    uint32_t value = (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+                     ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    lua_pushnumber(L, (lua_Number)value);
+    return 1;
+}
+
+static int lua_asset_view_i32(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    const uint8_t* p = assetViewBytes(L, view, luaL_checkinteger(L, 2), 4);
+    uint32_t value = (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+                     ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    lua_pushinteger(L, (int32_t)value);
+    return 1;
+}
+
+static int lua_asset_view_f32(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    const uint8_t* p = assetViewBytes(L, view, luaL_checkinteger(L, 2), 4);
+    float value;
+    std::memcpy(&value, p, sizeof(value));
+    lua_pushnumber(L, value);
+    return 1;
+}
+
+// view:sub(offset [, length]) - a narrower view over the same memory
+static int lua_asset_view_sub(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    lua_Integer offset = luaL_checkinteger(L, 2);
+    lua_Integer length = luaL_optinteger(L, 3, (lua_Integer)view->length - offset);
+    if (length < 0) {
+        return luaL_error(L, "asset view: negative length %d", (int)length);
+    }
+    assetViewBytes(L, view, offset, (size_t)length);
+    pushAssetView(L, view->asset, view->offset + (size_t)offset, (size_t)length);
+    return 1;
+}
+
+// view:string([offset, length]) - explicit copy, for the bits that really are text
+static int lua_asset_view_string(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    lua_Integer offset = luaL_optinteger(L, 2, 0);
+    lua_Integer length = luaL_optinteger(L, 3, (lua_Integer)view->length - offset);
+    if (length < 0) {
+        return luaL_error(L, "asset view: negative length %d", (int)length);
+    }
+    const uint8_t* p = assetViewBytes(L, view, offset, (size_t)length);
+    lua_pushlstring(L, (const char*)p, (size_t)length);
+    return 1;
+}
+
+static int lua_asset_view_gc(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    auto pin = s_assetViewPins.find(view->asset);
+    if (pin != s_assetViewPins.end() && --pin->second <= 0) {
+        s_assetViewPins.erase(pin);
+        auto deferred = s_assetDeferredUnload.find(view->asset);
+        if (deferred != s_assetDeferredUnload.end()) {
+            s_assetDeferredUnload.erase(deferred);
+            st_asset_unload(view->asset);
+        } else {
+            auto resident = s_assetResidency.find(view->asset);
+            if (resident != s_assetResidency.end()) {
+                assetEnforceBudget(s_assetTypeCaches[resident->second.type]);
+            }
+        }
     }
+    return 0;
+}
 
-    lua_pushnil(L);
+static int lua_asset_view_tostring(lua_State* L) {
+    AssetView* view = checkAssetView(L, 1);
+    lua_pushfstring(L, "AssetView(asset=%d, offset=%d, length=%d)",
+                    (int)view->asset, (int)view->offset, (int)view->length);
     return 1;
 }
 
+static void registerAssetViewMetatable(lua_State* L) {
+    luaL_newmetatable(L, ASSET_VIEW_METATABLE);
+
+    lua_newtable(L);
+    lua_pushcfunction(L, lua_asset_view_size);
+    lua_setfield(L, -2, "size");
+    lua_pushcfunction(L, lua_asset_view_byte);
+    lua_setfield(L, -2, "byte");
+    lua_pushcfunction(L, lua_asset_view_i8);
+    lua_setfield(L, -2, "i8");
+    lua_pushcfunction(L, lua_asset_view_u16);
+    lua_setfield(L, -2, "u16");
+    lua_pushcfunction(L, lua_asset_view_i16);
+    lua_setfield(L, -2, "i16");
+    lua_pushcfunction(L, lua_asset_view_u32);
+    lua_setfield(L, -2, "u32");
+    lua_pushcfunction(L, lua_asset_view_i32);
+    lua_setfield(L, -2, "i32");
+    lua_pushcfunction(L, lua_asset_view_f32);
+    lua_setfield(L, -2, "f32");
+    lua_pushcfunction(L, lua_asset_view_sub);
+    lua_setfield(L, -2, "sub");
+    lua_pushcfunction(L, lua_asset_view_string);
+    lua_setfield(L, -2, "string");
+    lua_setfield(L, -2, "__index");
+
+    lua_pushcfunction(L, lua_asset_view_size);
+    lua_setfield(L, -2, "__len");
+    lua_pushcfunction(L, lua_asset_view_gc);
+    lua_setfield(L, -2, "__gc");
+    lua_pushcfunction(L, lua_asset_view_tostring);
+    lua_setfield(L, -2, "__tostring");
+
+    lua_pop(L, 1);
+}
+
 static int lua_st_asset_get_size(lua_State* L) {
     STAssetID asset = luaL_checkinteger(L, 1);
 
@@ -3932,56 +5978,169 @@ static int lua_st_asset_exists(lua_State* L) {
     return 1;
 }
 
-static int lua_st_asset_list(lua_State* L) {
-    int type = luaL_optinteger(L, 1, -1);
+// =============================================================================
+// Asset Name Index
+// =============================================================================
+//
+// Sorted copy of the asset names per type (-1 = all), built from one
+// st_asset_list() pass and kept until the database changes. Prefix queries
+// and the literal head of a search pattern (over a lowercased copy, since
+// search is case-insensitive) are answered with a binary search;
+// list and search results are paged so a cart browser only materializes the
+// rows it is showing.
+
+static const std::vector<std::string>& assetNames(int type) {
+    auto it = s_assetNameIndex.find(type);
+    if (it != s_assetNameIndex.end()) {
+        return it->second.names;
+    }
 
-    // Get count first
+    AssetNameIndex& index = s_assetNameIndex[type];
     int count = st_asset_list(type, nullptr, 0);
-
-    if (count <= 0) {
-        lua_newtable(L);
-        return 1;
+    if (count > 0) {
+        std::vector<const char*> raw(count);
+        count = st_asset_list(type, raw.data(), count);
+        index.names.reserve(count);
+        for (int i = 0; i < count; i++) {
+            if (raw[i]) {
+                index.names.emplace_back(raw[i]);
+            }
+        }
+        std::sort(index.names.begin(), index.names.end());
     }
+    return index.names;
+}
 
-    // Allocate array for names
-    const char** names = new const char*[count];
-    st_asset_list(type, names, count);
-
-    // Create Lua table
-    lua_createtable(L, count, 0);
-    for (int i = 0; i < count; i++) {
-        lua_pushstring(L, names[i]);
-        lua_rawseti(L, -2, i + 1);  // Lua arrays are 1-indexed
+static std::string assetFoldCase(std::string text) {
+    for (char& c : text) {
+        c = (char)std::tolower((unsigned char)c);
     }
-
-    delete[] names;
-    return 1;
+    return text;
+}
+
+// Lowercased names sorted for case-insensitive prefix lookup, built on the
+// first search of a type
+static const std::vector<std::pair<std::string, size_t>>& assetFoldedNames(int type) {
+    const std::vector<std::string>& names = assetNames(type);
+    AssetNameIndex& index = s_assetNameIndex[type];
+    if (index.folded.empty() && !names.empty()) {
+        index.folded.reserve(names.size());
+        for (size_t i = 0; i < names.size(); i++) {
+            index.folded.emplace_back(assetFoldCase(names[i]), i);
+        }
+        std::sort(index.folded.begin(), index.folded.end());
+    }
+    return index.folded;
+}
+
+// SQL LIKE wildcards as the database search used them: '%' matches any run
+// and '_' any one character; '*' and '?' are accepted as glob spellings.
+// Both strings are expected case-folded.
+static bool assetGlobMatch(const char* pattern, const char* text) {
+    const char* starPattern = nullptr;
+    const char* starText = nullptr;
+    while (*text) {
+        if (*pattern == '*' || *pattern == '%') {
+            starPattern = ++pattern;
+            starText = text;
+        } else if (*pattern == '?' || *pattern == '_' || *pattern == *text) {
+            pattern++;
+            text++;
+        } else if (starPattern) {
+            pattern = starPattern;
+            text = ++starText;
+        } else {
+            return false;
+        }
+    }
+    while (*pattern == '*' || *pattern == '%') {
+        pattern++;
+    }
+    return *pattern == '\0';
 }
 
-static int lua_st_asset_search(lua_State* L) {
-    const char* pattern = luaL_checkstring(L, 1);
+// Range of sorted names starting with prefix
+static std::pair<size_t, size_t> assetPrefixRange(const std::vector<std::string>& names,
+                                                  const std::string& prefix) {
+    auto first = std::lower_bound(names.begin(), names.end(), prefix);
+    auto last = first;
+    while (last != names.end() && last->compare(0, prefix.size(), prefix) == 0) {
+        ++last;
+    }
+    return {(size_t)(first - names.begin()), (size_t)(last - names.begin())};
+}
+
+// Push one page of results as a table, followed by the total match count.
+// Arguments at offsetArg/offsetArg+1 are the 0-based offset and page size
+// (default: everything).
+static int pushAssetNamePage(lua_State* L, const std::vector<const std::string*>& matches, int offsetArg) {
+    lua_Integer offset = luaL_optinteger(L, offsetArg, 0);
+    lua_Integer limit = luaL_optinteger(L, offsetArg + 1, (lua_Integer)matches.size());
+    size_t first = (size_t)std::max<lua_Integer>(0, std::min<lua_Integer>(offset, (lua_Integer)matches.size()));
+    size_t last = std::min(matches.size(), first + (size_t)std::max<lua_Integer>(0, limit));
+
+    lua_createtable(L, (int)(last - first), 0);
+    for (size_t i = first; i < last; i++) {
+        lua_pushlstring(L, matches[i]->data(), matches[i]->size());
+        lua_rawseti(L, -2, (int)(i - first + 1));  // Lua arrays are 1-indexed
+    }
+    lua_pushinteger(L, (lua_Integer)matches.size());
+    return 2;
+}
 
-    // Get count first
-    int count = st_asset_search(pattern, nullptr, 0);
+// asset.list([type, offset, limit]) -> names, total
+static int lua_st_asset_list(lua_State* L) {
+    int type = luaL_optinteger(L, 1, -1);
 
-    if (count <= 0) {
-        lua_newtable(L);
-        return 1;
+    const std::vector<std::string>& names = assetNames(type);
+    std::vector<const std::string*> matches;
+    matches.reserve(names.size());
+    for (const auto& name : names) {
+        matches.push_back(&name);
     }
+    return pushAssetNamePage(L, matches, 2);
+}
 
-    // Allocate array for names
-    const char** names = new const char*[count];
-    st_asset_search(pattern, names, count);
+// asset.listPrefix(prefix [, type, offset, limit]) -> names, total
+static int lua_st_asset_list_prefix(lua_State* L) {
+    std::string prefix = luaL_checkstring(L, 1);
+    int type = luaL_optinteger(L, 2, -1);
 
-    // Create Lua table
-    lua_createtable(L, count, 0);
-    for (int i = 0; i < count; i++) {
-        lua_pushstring(L, names[i]);
-        lua_rawseti(L, -2, i + 1);
+    const std::vector<std::string>& names = assetNames(type);
+    auto range = assetPrefixRange(names, prefix);
+    std::vector<const std::string*> matches;
+    matches.reserve(range.second - range.first);
+    for (size_t i = range.first; i < range.second; i++) {
+        matches.push_back(&names[i]);
     }
+    return pushAssetNamePage(L, matches, 3);
+}
 
-    delete[] names;
-    return 1;
+// asset.search(pattern [, offset, limit]) -> names, total
+// LIKE pattern, case-insensitive; a pattern without wildcards matches names
+// containing it.
+static int lua_st_asset_search(lua_State* L) {
+    std::string pattern = assetFoldCase(luaL_checkstring(L, 1));
+    size_t wildcard = pattern.find_first_of("*?%_");
+    if (wildcard == std::string::npos) {
+        pattern = "%" + pattern + "%";
+        wildcard = 0;
+    }
+
+    const std::vector<std::string>& names = assetNames(-1);
+    const auto& folded = assetFoldedNames(-1);
+    std::string prefix = pattern.substr(0, wildcard);
+    auto it = std::lower_bound(folded.begin(), folded.end(), prefix,
+                               [](const std::pair<std::string, size_t>& entry, const std::string& key) {
+                                   return entry.first < key;
+                               });
+    std::vector<const std::string*> matches;
+    for (; it != folded.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+        if (assetGlobMatch(pattern.c_str(), it->first.c_str())) {
+            matches.push_back(&names[it->second]);
+        }
+    }
+    return pushAssetNamePage(L, matches, 2);
 }
 
 static int lua_st_asset_get_count(lua_State* L) {
@@ -3995,6 +6154,7 @@ static int lua_st_asset_get_count(lua_State* L) {
 // Cache Management
 static int lua_st_asset_clear_cache(lua_State* L) {
     (void)L;
+    assetResidencyReset();
     st_asset_clear_cache();
     return 0;
 }
@@ -4187,6 +6347,531 @@ static int lua_st_tilemap_clear(lua_State* L) {
     return 0;
 }
 
+// =============================================================================
+// Tilemap Bulk Region API
+// =============================================================================
+//
+// Region calls move a whole rectangle of tile IDs across the binding in one
+// call instead of one TILEMAP_SET_TILE per cell. Tiles are row-major and come
+// from either an array (BASIC arrays start at index 0, so `start` defaults to
+// 0) or a packed string: 2 bytes per tile little-endian, or 1 byte per tile
+// when the string is exactly width*height long.
+
+static bool tilemapRegionArgs(lua_State* L, int first, int32_t* x, int32_t* y,
+                              int32_t* width, int32_t* height) {
+    *x = (int32_t)luaL_checkinteger(L, first);
+    *y = (int32_t)luaL_checkinteger(L, first + 1);
+    *width = (int32_t)luaL_checkinteger(L, first + 2);
+    *height = (int32_t)luaL_checkinteger(L, first + 3);
+    return *width > 0 && *height > 0;
+}
+
+// Read width*height tile IDs from the table or packed string at index
+static void tilemapReadTiles(lua_State* L, int index, int start, size_t count, std::vector<uint16_t>& tiles) {
+    tiles.resize(count);
+    if (lua_type(L, index) == LUA_TSTRING) {
+        size_t length = 0;
+        const uint8_t* bytes = (const uint8_t*)lua_tolstring(L, index, &length);
+        if (length == count * 2) {
+            for (size_t i = 0; i < count; i++) {
+                tiles[i] = (uint16_t)(bytes[i * 2] | (bytes[i * 2 + 1] << 8));
+            }
+        } else if (length == count) {
+            for (size_t i = 0; i < count; i++) {
+                tiles[i] = bytes[i];
+            }
+        } else {
+            luaL_error(L, "tilemap region: packed string is %d bytes, expected %d or %d",
+                       (int)length, (int)count, (int)(count * 2));
+        }
+        return;
+    }
+
+    luaL_checktype(L, index, LUA_TTABLE);
+    for (size_t i = 0; i < count; i++) {
+        lua_rawgeti(L, index, start + (int)i);
+        tiles[i] = (uint16_t)lua_tointeger(L, -1);
+        lua_pop(L, 1);
+    }
+}
+
+static void tilemapWriteRegion(STLayerID layer, int32_t x, int32_t y, int32_t width, int32_t height,
+                               const std::vector<uint16_t>& tiles) {
+    size_t i = 0;
+    for (int32_t row = 0; row < height; row++) {
+        for (int32_t col = 0; col < width; col++) {
+            st_tilemap_set_tile(layer, x + col, y + row, tiles[i++]);
+        }
+    }
+}
+
+static void tilemapReadRegion(STLayerID layer, int32_t x, int32_t y, int32_t width, int32_t height,
+                              std::vector<uint16_t>& tiles) {
+    tiles.resize((size_t)width * height);
+    size_t i = 0;
+    for (int32_t row = 0; row < height; row++) {
+        for (int32_t col = 0; col < width; col++) {
+            tiles[i++] = st_tilemap_get_tile(layer, x + col, y + row);
+        }
+    }
+}
+
+// tilemap.setRegion(layer, x, y, width, height, tiles [, start])
+static int lua_st_tilemap_set_region(lua_State* L) {
+    STLayerID layer = (STLayerID)luaL_checkinteger(L, 1);
+    int32_t x, y, width, height;
+    if (!tilemapRegionArgs(L, 2, &x, &y, &width, &height)) {
+        return 0;
+    }
+    int start = luaL_optinteger(L, 7, 0);
+
+    std::vector<uint16_t> tiles;
+    tilemapReadTiles(L, 6, start, (size_t)width * height, tiles);
+    tilemapWriteRegion(layer, x, y, width, height, tiles);
+    return 0;
+}
+
+// tilemap.getRegion(layer, x, y, width, height [, array, start])
+// Fills array from start (default 0) and returns it; with no array, returns
+// a new 1-based table.
+static int lua_st_tilemap_get_region(lua_State* L) {
+    STLayerID layer = (STLayerID)luaL_checkinteger(L, 1);
+    int32_t x, y, width, height;
+    if (!tilemapRegionArgs(L, 2, &x, &y, &width, &height)) {
+        lua_newtable(L);
+        return 1;
+    }
+
+    std::vector<uint16_t> tiles;
+    tilemapReadRegion(layer, x, y, width, height, tiles);
+
+    int start = 1;
+    if (lua_istable(L, 6)) {
+        start = luaL_optinteger(L, 7, 0);
+        lua_pushvalue(L, 6);
+    } else {
+        lua_createtable(L, (int)tiles.size(), 0);
+    }
+    for (size_t i = 0; i < tiles.size(); i++) {
+        lua_pushinteger(L, tiles[i]);
+        lua_rawseti(L, -2, start + (int)i);
+    }
+    return 1;
+}
+
+// tilemap.getRegionPacked(layer, x, y, width, height) -> 2 bytes per tile
+static int lua_st_tilemap_get_region_packed(lua_State* L) {
+    STLayerID layer = (STLayerID)luaL_checkinteger(L, 1);
+    int32_t x, y, width, height;
+    if (!tilemapRegionArgs(L, 2, &x, &y, &width, &height)) {
+        lua_pushliteral(L, "");
+        return 1;
+    }
+
+    std::vector<uint16_t> tiles;
+    tilemapReadRegion(layer, x, y, width, height, tiles);
+
+    std::string packed(tiles.size() * 2, '\0');
+    for (size_t i = 0; i < tiles.size(); i++) {
+        packed[i * 2] = (char)(tiles[i] & 0xFF);
+        packed[i * 2 + 1] = (char)(tiles[i] >> 8);
+    }
+    lua_pushlstring(L, packed.data(), packed.size());
+    return 1;
+}
+
+// tilemap.copyRegion(srcLayer, x, y, width, height, dstLayer, dstX, dstY)
+// Reads the whole source first, so overlapping copies on one layer are safe.
+static int lua_st_tilemap_copy_region(lua_State* L) {
+    STLayerID srcLayer = (STLayerID)luaL_checkinteger(L, 1);
+    int32_t x, y, width, height;
+    bool nonEmpty = tilemapRegionArgs(L, 2, &x, &y, &width, &height);
+    STLayerID dstLayer = (STLayerID)luaL_checkinteger(L, 6);
+    int32_t dstX = (int32_t)luaL_checkinteger(L, 7);
+    int32_t dstY = (int32_t)luaL_checkinteger(L, 8);
+    if (!nonEmpty) {
+        return 0;
+    }
+
+    std::vector<uint16_t> tiles;
+    tilemapReadRegion(srcLayer, x, y, width, height, tiles);
+    tilemapWriteRegion(dstLayer, dstX, dstY, width, height, tiles);
+    return 0;
+}
+
+// tilemap.setRow(layer, x, y, count, tiles [, start]) - stream in one row
+static int lua_st_tilemap_set_row(lua_State* L) {
+    STLayerID layer = (STLayerID)luaL_checkinteger(L, 1);
+    int32_t x = (int32_t)luaL_checkinteger(L, 2);
+    int32_t y = (int32_t)luaL_checkinteger(L, 3);
+    int32_t count = (int32_t)luaL_checkinteger(L, 4);
+    int start = luaL_optinteger(L, 6, 0);
+    if (count <= 0) {
+        return 0;
+    }
+
+    std::vector<uint16_t> tiles;
+    tilemapReadTiles(L, 5, start, (size_t)count, tiles);
+    tilemapWriteRegion(layer, x, y, count, 1, tiles);
+    return 0;
+}
+
+// tilemap.setColumn(layer, x, y, count, tiles [, start]) - stream in one column
+static int lua_st_tilemap_set_column(lua_State* L) {
+    STLayerID layer = (STLayerID)luaL_checkinteger(L, 1);
+    int32_t x = (int32_t)luaL_checkinteger(L, 2);
+    int32_t y = (int32_t)luaL_checkinteger(L, 3);
+    int32_t count = (int32_t)luaL_checkinteger(L, 4);
+    int start = luaL_optinteger(L, 6, 0);
+    if (count <= 0) {
+        return 0;
+    }
+
+    std::vector<uint16_t> tiles;
+    tilemapReadTiles(L, 5, start, (size_t)count, tiles);
+    tilemapWriteRegion(layer, x, y, 1, count, tiles);
+    return 0;
+}
+
+// =============================================================================
+// Chunked Tilemaps
+// =============================================================================
+//
+// A chunk map is an unbounded world stored as fixed-size square chunks that
+// exist only near the camera. The layer shows a window of (2*radius+1)^2
+// chunks through an ordinary tilemap; when the camera crosses into another
+// chunk the window is re-centred, chunks further than radius+1 away are
+// dropped, and missing ones are queued for the generator. The generator is
+// called as gen(map_id, chunk_x, chunk_y) and fills the chunk with
+// CHUNKMAP_SET_TILE / CHUNKMAP_SET_REGION in world tile coordinates. It is
+// run nearest-first from CHUNKMAP_SET_CAMERA within a small time budget.
+// Dropped chunks are regenerated when revisited, so generators should be
+// deterministic in (chunk_x, chunk_y).
+//
+// The Framework has a single tilemap camera shared by every layer, and
+// CHUNKMAP_SET_CAMERA drives it in window coordinates, so only one chunk map
+// can exist at a time. Other tilemap layers scroll with it; give them a
+// parallax factor to move at a different rate. All chunk maps are destroyed
+// when the script ends.
+
+static const double CHUNKMAP_GENERATE_BUDGET_MS = 2.0;
+
+struct ChunkMap {
+    STLayerID layer;
+    STTilemapID tilemap;
+    int32_t tileWidth;
+    int32_t tileHeight;
+    int32_t chunkSize;
+    int32_t radius;
+    int32_t originChunkX;   // world chunk shown at tile (0,0) of the window
+    int32_t originChunkY;
+    int32_t cameraChunkX;
+    int32_t cameraChunkY;
+    int generatorRef;
+    std::unordered_map<int64_t, std::vector<uint16_t>> chunks;
+    std::vector<std::pair<int32_t, int32_t>> pending;
+};
+
+static std::map<int, ChunkMap> s_chunkMaps;
+static int s_nextChunkMapID = 1;
+
+static inline int64_t chunkKey(int32_t cx, int32_t cy) {
+    return ((int64_t)cx << 32) | (uint32_t)cy;
+}
+
+// Floor division, so tile -1 lands in chunk -1 rather than chunk 0
+static inline int32_t chunkFloorDiv(int32_t value, int32_t size) {
+    return value >= 0 ? value / size : -((-value + size - 1) / size);
+}
+
+static ChunkMap* checkChunkMap(lua_State* L, int index) {
+    int id = (int)luaL_checkinteger(L, index);
+    auto it = s_chunkMaps.find(id);
+    if (it == s_chunkMaps.end()) {
+        luaL_error(L, "chunkmap: invalid map id %d", id);
+        return nullptr;
+    }
+    return &it->second;
+}
+
+static bool chunkInWindow(const ChunkMap& map, int32_t cx, int32_t cy) {
+    int32_t span = map.radius * 2 + 1;
+    return cx >= map.originChunkX && cx < map.originChunkX + span &&
+           cy >= map.originChunkY && cy < map.originChunkY + span;
+}
+
+// Copy one chunk (or blank, if not resident) into the window tilemap
+static void chunkBlit(const ChunkMap& map, int32_t cx, int32_t cy) {
+    if (!chunkInWindow(map, cx, cy)) {
+        return;
+    }
+    auto it = map.chunks.find(chunkKey(cx, cy));
+    const uint16_t* tiles = it != map.chunks.end() ? it->second.data() : nullptr;
+    int32_t baseX = (cx - map.originChunkX) * map.chunkSize;
+    int32_t baseY = (cy - map.originChunkY) * map.chunkSize;
+    for (int32_t y = 0; y < map.chunkSize; y++) {
+        for (int32_t x = 0; x < map.chunkSize; x++) {
+            uint16_t tile = tiles ? tiles[y * map.chunkSize + x] : 0;
+            st_tilemap_set_tile(map.layer, baseX + x, baseY + y, tile);
+        }
+    }
+}
+
+static std::vector<uint16_t>& chunkEnsure(ChunkMap& map, int32_t cx, int32_t cy) {
+    std::vector<uint16_t>& tiles = map.chunks[chunkKey(cx, cy)];
+    if (tiles.empty()) {
+        tiles.assign((size_t)map.chunkSize * map.chunkSize, 0);
+    }
+    return tiles;
+}
+
+static void chunkSetTile(ChunkMap& map, int32_t x, int32_t y, uint16_t tile) {
+    int32_t cx = chunkFloorDiv(x, map.chunkSize);
+    int32_t cy = chunkFloorDiv(y, map.chunkSize);
+    std::vector<uint16_t>& tiles = chunkEnsure(map, cx, cy);
+    tiles[(y - cy * map.chunkSize) * map.chunkSize + (x - cx * map.chunkSize)] = tile;
+    if (chunkInWindow(map, cx, cy)) {
+        st_tilemap_set_tile(map.layer,
+                            x - map.originChunkX * map.chunkSize,
+                            y - map.originChunkY * map.chunkSize, tile);
+    }
+}
+
+// Re-centre the window on the camera chunk: drop far chunks, queue missing
+// ones nearest-first and redraw the window
+static void chunkRecentre(ChunkMap& map, int32_t cameraChunkX, int32_t cameraChunkY) {
+    map.cameraChunkX = cameraChunkX;
+    map.cameraChunkY = cameraChunkY;
+    map.originChunkX = cameraChunkX - map.radius;
+    map.originChunkY = cameraChunkY - map.radius;
+
+    int32_t keep = map.radius + 1;
+    for (auto it = map.chunks.begin(); it != map.chunks.end();) {
+        int32_t cx = (int32_t)(it->first >> 32);
+        int32_t cy = (int32_t)(uint32_t)it->first;
+        if (std::abs(cx - cameraChunkX) > keep || std::abs(cy - cameraChunkY) > keep) {
+            it = map.chunks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    map.pending.clear();
+    for (int32_t cy = map.originChunkY; cy <= cameraChunkY + map.radius; cy++) {
+        for (int32_t cx = map.originChunkX; cx <= cameraChunkX + map.radius; cx++) {
+            if (!map.chunks.count(chunkKey(cx, cy))) {
+                map.pending.push_back({cx, cy});
+            }
+            chunkBlit(map, cx, cy);
+        }
+    }
+
+    // Farthest first, so the nearest chunk is popped from the back
+    std::sort(map.pending.begin(), map.pending.end(),
+              [&](const std::pair<int32_t, int32_t>& a, const std::pair<int32_t, int32_t>& b) {
+                  int32_t da = std::max(std::abs(a.first - cameraChunkX), std::abs(a.second - cameraChunkY));
+                  int32_t db = std::max(std::abs(b.first - cameraChunkX), std::abs(b.second - cameraChunkY));
+                  return da > db;
+              });
+}
+
+static void chunkGeneratePending(lua_State* L, int mapID) {
+    auto start = std::chrono::steady_clock::now();
+    for (;;) {
+        // Looked up each time round: the generator may destroy the map
+        auto it = s_chunkMaps.find(mapID);
+        if (it == s_chunkMaps.end()) {
+            return;
+        }
+        ChunkMap& map = it->second;
+        if (map.generatorRef == LUA_NOREF) {
+            map.pending.clear();
+            return;
+        }
+        if (map.pending.empty()) {
+            return;
+        }
+
+        std::pair<int32_t, int32_t> chunk = map.pending.back();
+        map.pending.pop_back();
+
+        lua_rawgeti(L, LUA_REGISTRYINDEX, map.generatorRef);
+        lua_pushinteger(L, mapID);
+        lua_pushinteger(L, chunk.first);
+        lua_pushinteger(L, chunk.second);
+        bool generated = lua_pcall(L, 3, 0, 0) == LUA_OK;
+
+        it = s_chunkMaps.find(mapID);
+        if (it != s_chunkMaps.end()) {
+            ChunkMap& current = it->second;
+            if (generated) {
+                // A generator that wrote nothing still leaves a blank chunk
+                chunkEnsure(current, chunk.first, chunk.second);
+            } else {
+                // Leave the chunk missing so the next visit retries it
+                current.chunks.erase(chunkKey(chunk.first, chunk.second));
+                chunkBlit(current, chunk.first, chunk.second);
+            }
+        }
+        if (!generated) {
+            lua_error(L);   // Re-raise the generator's error
+        }
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= CHUNKMAP_GENERATE_BUDGET_MS) {
+            return;
+        }
+    }
+}
+
+static void chunkMapsReset(lua_State* L) {
+    for (auto& pair : s_chunkMaps) {
+        if (L && pair.second.generatorRef != LUA_NOREF) {
+            luaL_unref(L, LUA_REGISTRYINDEX, pair.second.generatorRef);
+        }
+        st_tilemap_destroy(pair.second.tilemap);
+    }
+    s_chunkMaps.clear();
+}
+
+// chunkmap_create(layer, tile_width, tile_height, chunk_size, radius, generator)
+// generator is a function or the name of a global function
+static int lua_st_chunkmap_create(lua_State* L) {
+    STLayerID layer = (STLayerID)luaL_checkinteger(L, 1);
+    int32_t tileWidth = (int32_t)luaL_checkinteger(L, 2);
+    int32_t tileHeight = (int32_t)luaL_checkinteger(L, 3);
+    int32_t chunkSize = (int32_t)luaL_optinteger(L, 4, 32);
+    int32_t radius = (int32_t)luaL_optinteger(L, 5, 1);
+    if (tileWidth <= 0 || tileHeight <= 0 || chunkSize <= 0 || radius < 0) {
+        return luaL_error(L, "chunkmap_create: sizes must be positive and radius >= 0");
+    }
+    if (!s_chunkMaps.empty()) {
+        return luaL_error(L, "chunkmap_create: only one chunk map at a time (the tilemap camera is shared)");
+    }
+
+    int generatorRef = LUA_NOREF;
+    if (lua_type(L, 6) == LUA_TSTRING && lua_tostring(L, 6)[0] != '\0') {
+        lua_getglobal(L, lua_tostring(L, 6));
+        if (!lua_isfunction(L, -1)) {
+            return luaL_error(L, "chunkmap_create: no function named '%s'", lua_tostring(L, 6));
+        }
+        generatorRef = luaL_ref(L, LUA_REGISTRYINDEX);
+    } else if (lua_isfunction(L, 6)) {
+        lua_pushvalue(L, 6);
+        generatorRef = luaL_ref(L, LUA_REGISTRYINDEX);
+    }
+
+    int32_t span = (radius * 2 + 1) * chunkSize;
+    STTilemapID tilemap = st_tilemap_create(span, span, tileWidth, tileHeight);
+    st_tilemap_layer_set_tilemap(layer, tilemap);
+
+    int id = s_nextChunkMapID++;
+    ChunkMap& map = s_chunkMaps[id];
+    map.layer = layer;
+    map.tilemap = tilemap;
+    map.tileWidth = tileWidth;
+    map.tileHeight = tileHeight;
+    map.chunkSize = chunkSize;
+    map.radius = radius;
+    map.generatorRef = generatorRef;
+    chunkRecentre(map, 0, 0);
+
+    lua_pushinteger(L, id);
+    return 1;
+}
+
+static int lua_st_chunkmap_destroy(lua_State* L) {
+    int id = (int)luaL_checkinteger(L, 1);
+    auto it = s_chunkMaps.find(id);
+    if (it != s_chunkMaps.end()) {
+        if (it->second.generatorRef != LUA_NOREF) {
+            luaL_unref(L, LUA_REGISTRYINDEX, it->second.generatorRef);
+        }
+        st_tilemap_destroy(it->second.tilemap);
+        s_chunkMaps.erase(it);
+    }
+    return 0;
+}
+
+// chunkmap_set_camera(map, world_x, world_y) - world pixel coordinates
+static int lua_st_chunkmap_set_camera(lua_State* L) {
+    int id = (int)luaL_checkinteger(L, 1);
+    ChunkMap* map = checkChunkMap(L, 1);
+    float worldX = (float)luaL_checknumber(L, 2);
+    float worldY = (float)luaL_checknumber(L, 3);
+
+    int32_t chunkPixelsX = map->chunkSize * map->tileWidth;
+    int32_t chunkPixelsY = map->chunkSize * map->tileHeight;
+    int32_t cameraChunkX = (int32_t)std::floor(worldX / chunkPixelsX);
+    int32_t cameraChunkY = (int32_t)std::floor(worldY / chunkPixelsY);
+    if (cameraChunkX != map->cameraChunkX || cameraChunkY != map->cameraChunkY) {
+        chunkRecentre(*map, cameraChunkX, cameraChunkY);
+    }
+
+    // The shared tilemap camera; see the section note
+    st_tilemap_set_camera(worldX - (float)map->originChunkX * chunkPixelsX,
+                          worldY - (float)map->originChunkY * chunkPixelsY);
+
+    chunkGeneratePending(L, id);
+    return 0;
+}
+
+static int lua_st_chunkmap_set_tile(lua_State* L) {
+    ChunkMap* map = checkChunkMap(L, 1);
+    int32_t x = (int32_t)luaL_checkinteger(L, 2);
+    int32_t y = (int32_t)luaL_checkinteger(L, 3);
+    uint16_t tile = (uint16_t)luaL_checkinteger(L, 4);
+    chunkSetTile(*map, x, y, tile);
+    return 0;
+}
+
+static int lua_st_chunkmap_get_tile(lua_State* L) {
+    ChunkMap* map = checkChunkMap(L, 1);
+    int32_t x = (int32_t)luaL_checkinteger(L, 2);
+    int32_t y = (int32_t)luaL_checkinteger(L, 3);
+    int32_t cx = chunkFloorDiv(x, map->chunkSize);
+    int32_t cy = chunkFloorDiv(y, map->chunkSize);
+    auto it = map->chunks.find(chunkKey(cx, cy));
+    uint16_t tile = 0;
+    if (it != map->chunks.end()) {
+        tile = it->second[(y - cy * map->chunkSize) * map->chunkSize + (x - cx * map->chunkSize)];
+    }
+    lua_pushinteger(L, tile);
+    return 1;
+}
+
+// chunkmap_set_region(map, x, y, width, height, tiles [, start]) - see TILEMAP_SET_REGION
+static int lua_st_chunkmap_set_region(lua_State* L) {
+    ChunkMap* map = checkChunkMap(L, 1);
+    int32_t x, y, width, height;
+    if (!tilemapRegionArgs(L, 2, &x, &y, &width, &height)) {
+        return 0;
+    }
+    int start = luaL_optinteger(L, 7, 0);
+
+    std::vector<uint16_t> tiles;
+    tilemapReadTiles(L, 6, start, (size_t)width * height, tiles);
+    size_t i = 0;
+    for (int32_t row = 0; row < height; row++) {
+        for (int32_t col = 0; col < width; col++) {
+            chunkSetTile(*map, x + col, y + row, tiles[i++]);
+        }
+    }
+    return 0;
+}
+
+static int lua_st_chunkmap_get_resident(lua_State* L) {
+    ChunkMap* map = checkChunkMap(L, 1);
+    lua_pushinteger(L, (lua_Integer)map->chunks.size());
+    return 1;
+}
+
+static int lua_st_chunkmap_get_pending(lua_State* L) {
+    ChunkMap* map = checkChunkMap(L, 1);
+    lua_pushinteger(L, (lua_Integer)map->pending.size());
+    return 1;
+}
+
 static int lua_st_tilemap_set_camera(lua_State* L) {
     float x = (float)luaL_checknumber(L, 1);
     float y = (float)luaL_checknumber(L, 2);
@@ -4342,8 +7027,15 @@ static int lua_st_tilemap_layer_set_tileset(lua_State* L) {
 
 static int lua_basic_rnd(lua_State* L) {
     // RND generates random number 0.0 to 1.0
-    double r = (double)rand() / (double)RAND_MAX;
-    lua_pushnumber(L, r);
+    // RND(-n) reseeds with n first, as in classic BASIC
+    BasicRandom* rng = basicRandomUpvalue(L);
+    if (lua_gettop(L) >= 1 && lua_isnumber(L, 1)) {
+        lua_Number x = lua_tonumber(L, 1);
+        if (x < 0) {
+            basicRandomSeed(rng, (uint64_t)(int64_t)x);
+        }
+    }
+    lua_pushnumber(L, basicRandomDouble(rng));
     return 1;
 }
 
@@ -5374,11 +8066,37 @@ static int lua_video_circle_gradient_aa(lua_State* L) {
 // =============================================================================
 
 void registerBindings(lua_State* L) {
-    // Seed random number generator
-    srand((unsigned int)time(NULL));
+    // Per-state random number generator, seeded from the clock until the
+    // script calls RANDOMIZE / RND(-n)
+    {
+        BasicRandom* rng = (BasicRandom*)lua_newuserdata(L, sizeof(BasicRandom));
+        basicRandomSeed(rng, (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count());
+
+        const struct { const char* name; lua_CFunction func; } rngFunctions[] = {
+            {"basic_rnd", lua_basic_rnd},
+            {"st_rand", lua_st_rand},
+            {"st_rand_seed", lua_st_rand_seed},
+            {"st_rand_fill", lua_st_rand_fill},
+        };
+        for (const auto& entry : rngFunctions) {
+            lua_pushvalue(L, -1);
+            lua_pushcclosure(L, entry.func, 1);
+            lua_setglobal(L, entry.name);
+        }
+
+        lua_getglobal(L, "math");
+        if (lua_istable(L, -1)) {
+            lua_pushvalue(L, -2);
+            lua_pushcclosure(L, lua_math_random, 1);
+            lua_setfield(L, -2, "random");
+            lua_pushvalue(L, -2);
+            lua_pushcclosure(L, lua_math_randomseed, 1);
+            lua_setfield(L, -2, "randomseed");
+        }
+        lua_pop(L, 2);  // Pop math table and generator
+    }
 
     // BASIC Math Functions
-    luaL_setglobalfunction(L, "basic_rnd", lua_basic_rnd);
     luaL_setglobalfunction(L, "basic_int", lua_basic_int);
     luaL_setglobalfunction(L, "basic_abs", lua_basic_abs);
     luaL_setglobalfunction(L, "basic_sqr", lua_basic_sqr);
@@ -5427,6 +8145,8 @@ void registerBindings(lua_State* L) {
         int timeout_frames = (timeout_seconds > 0) ? (int)(timeout_seconds * 60.0f) : -1;
         int frames_waited = 0;
         
+        flushVoiceParameters();
+
         // Clear input buffer first
         st_key_clear_buffer();
         
@@ -5686,6 +8406,10 @@ void registerBindings(lua_State* L) {
     luaL_setglobalfunction(L, "st_music_play_file_with_format", lua_st_music_play_file_with_format);
     luaL_setglobalfunction(L, "st_music_render_to_wav", lua_st_music_render_to_wav);
     luaL_setglobalfunction(L, "st_music_render_to_slot", lua_st_music_render_to_slot);
+    luaL_setglobalfunction(L, "st_music_render_to_wav_async", lua_st_music_render_to_wav_async);
+    luaL_setglobalfunction(L, "st_music_render_to_slot_async", lua_st_music_render_to_slot_async);
+    luaL_setglobalfunction(L, "render_job_done", lua_st_render_job_done);
+    luaL_setglobalfunction(L, "render_job_result", lua_st_render_job_result);
     luaL_setglobalfunction(L, "music_stop", lua_st_music_stop);
     luaL_setglobalfunction(L, "music_pause", lua_st_music_pause);
     luaL_setglobalfunction(L, "music_resume", lua_st_music_resume);
@@ -5780,6 +8504,8 @@ void registerBindings(lua_State* L) {
     luaL_setglobalfunction(L, "sound_exists", lua_st_sound_exists);
     luaL_setglobalfunction(L, "sound_get_count", lua_st_sound_get_count);
     luaL_setglobalfunction(L, "sound_get_memory_usage", lua_st_sound_get_memory_usage);
+    luaL_setglobalfunction(L, "sound_cache_get_hits", lua_st_sound_cache_get_hits);
+    luaL_setglobalfunction(L, "sound_cache_get_misses", lua_st_sound_cache_get_misses);
 
     // Voice Controller API
     // Waveform constants
@@ -5811,6 +8537,10 @@ void registerBindings(lua_State* L) {
     luaL_setglobalfunction(L, "voice_reset_all", lua_st_voice_reset_all);
     luaL_setglobalfunction(L, "voice_get_active_count", lua_st_voice_get_active_count);
     luaL_setglobalfunction(L, "voices_are_playing", lua_st_voices_are_playing);
+    luaL_setglobalfunction(L, "voice_queue_stats", lua_st_voice_queue_stats);
+    luaL_setglobalfunction(L, "voice_queue_get_depth", lua_st_voice_queue_get_depth);
+    luaL_setglobalfunction(L, "voice_queue_get_coalesced", lua_st_voice_queue_get_coalesced);
+    luaL_setglobalfunction(L, "voice_flush", lua_st_voice_flush);
     luaL_setglobalfunction(L, "voice_direct", lua_st_voice_direct);
     luaL_setglobalfunction(L, "voice_direct_slot", lua_st_voice_direct_slot);
     luaL_setglobalfunction(L, "vscript_save_to_bank", lua_st_vscript_save_to_bank);
@@ -5858,6 +8588,17 @@ void registerBindings(lua_State* L) {
     luaL_setglobalfunction(L, "voices_next_slot", lua_st_voices_next_slot);
     luaL_setglobalfunction(L, "voices_end_play", lua_st_voices_end_play);
     luaL_setglobalfunction(L, "voices_end_save", lua_st_voices_end_save);
+    luaL_setglobalfunction(L, "voices_end_save_async", lua_st_voices_end_save_async);
+    luaL_setglobalfunction(L, "voice_benchmark", lua_st_voice_benchmark);
+    luaL_setglobalfunction(L, "voice_benchmark_cost", lua_st_voice_benchmark_cost);
+    luaL_setglobalfunction(L, "voice_waveform_at", lua_st_voice_waveform_at);
+    luaL_setglobalfunction(L, "voice_envelope_at", lua_st_voice_envelope_at);
+    luaL_setglobalfunction(L, "voice_frequency_at", lua_st_voice_frequency_at);
+    luaL_setglobalfunction(L, "voice_volume_at", lua_st_voice_volume_at);
+    luaL_setglobalfunction(L, "voice_pan_at", lua_st_voice_pan_at);
+    luaL_setglobalfunction(L, "voice_gate_at", lua_st_voice_gate_at);
+    luaL_setglobalfunction(L, "voice_filter_at", lua_st_voice_filter_at);
+    luaL_setglobalfunction(L, "voice_sequence_at", lua_st_voice_sequence_at);
 
     // Input API
     luaL_setglobalfunction(L, "key_pressed", lua_st_key_pressed);
@@ -5871,9 +8612,6 @@ void registerBindings(lua_State* L) {
     luaL_setglobalfunction(L, "mouse_button_just_pressed", lua_st_mouse_button_just_pressed);
     luaL_setglobalfunction(L, "mouse_button_just_released", lua_st_mouse_button_just_released);
 
-    // Random number generation
-    luaL_setglobalfunction(L, "st_rand", lua_st_rand);
-
     // BASIC Input Functions
     luaL_setglobalfunction(L, "basic_input_at", lua_st_basic_input_at);
 
@@ -6110,6 +8848,8 @@ void registerBindings(lua_State* L) {
     luaL_setglobalfunction(L, "sprite_explode_advanced", lua_sprite_explode_advanced);
     luaL_setglobalfunction(L, "sprite_explode_directional", lua_sprite_explode_directional);
     luaL_setglobalfunction(L, "sprite_explode_mode", lua_sprite_explode_mode);
+    luaL_setglobalfunction(L, "sprite_explode_range", lua_sprite_explode_range);
+    luaL_setglobalfunction(L, "sprite_explode_set_budget", lua_sprite_explode_set_budget);
     luaL_setglobalfunction(L, "sprite_explode_size", lua_sprite_explode_size);
 
     // Explosion mode constants
@@ -6133,6 +8873,7 @@ void registerBindings(lua_State* L) {
     luaL_setglobalnumber(L, "ASSET_DATA", ST_ASSET_DATA);
 
     // Asset Management API - Create 'asset' namespace table
+    registerAssetViewMetatable(L);
     lua_newtable(L);
 
     // Initialization functions
@@ -6158,6 +8899,15 @@ void registerBindings(lua_State* L) {
     lua_pushcfunction(L, lua_st_asset_is_loaded);
     lua_setfield(L, -2, "isLoaded");
 
+    lua_pushcfunction(L, lua_st_asset_prefetch);
+    lua_setfield(L, -2, "prefetch");
+
+    lua_pushcfunction(L, lua_st_asset_prefetch_pending);
+    lua_setfield(L, -2, "prefetchPending");
+
+    lua_pushcfunction(L, lua_st_asset_prefetch_bytes);
+    lua_setfield(L, -2, "prefetchBytes");
+
     // Import/Export functions
     lua_pushcfunction(L, lua_st_asset_import);
     lua_setfield(L, -2, "import");
@@ -6175,6 +8925,9 @@ void registerBindings(lua_State* L) {
     lua_pushcfunction(L, lua_st_asset_get_data);
     lua_setfield(L, -2, "getData");
 
+    lua_pushcfunction(L, lua_st_asset_view);
+    lua_setfield(L, -2, "view");
+
     lua_pushcfunction(L, lua_st_asset_get_size);
     lua_setfield(L, -2, "getSize");
 
@@ -6194,6 +8947,9 @@ void registerBindings(lua_State* L) {
     lua_pushcfunction(L, lua_st_asset_search);
     lua_setfield(L, -2, "search");
 
+    lua_pushcfunction(L, lua_st_asset_list_prefix);
+    lua_setfield(L, -2, "listPrefix");
+
     lua_pushcfunction(L, lua_st_asset_get_count);
     lua_setfield(L, -2, "getCount");
 
@@ -6210,6 +8966,18 @@ void registerBindings(lua_State* L) {
     lua_pushcfunction(L, lua_st_asset_set_max_cache_size);
     lua_setfield(L, -2, "setMaxCacheSize");
 
+    lua_pushcfunction(L, lua_st_asset_set_type_budget);
+    lua_setfield(L, -2, "setTypeBudget");
+
+    lua_pushcfunction(L, lua_st_asset_pin);
+    lua_setfield(L, -2, "pin");
+
+    lua_pushcfunction(L, lua_st_asset_unpin);
+    lua_setfield(L, -2, "unpin");
+
+    lua_pushcfunction(L, lua_st_asset_get_type_stats);
+    lua_setfield(L, -2, "getTypeStats");
+
     // Statistics functions
     lua_pushcfunction(L, lua_st_asset_get_hit_rate);
     lua_setfield(L, -2, "getHitRate");
@@ -6227,6 +8995,20 @@ void registerBindings(lua_State* L) {
     // Set the 'asset' global table
     lua_setglobal(L, "asset");
 
+    // Asset prefetch (BASIC: ASSET_PREFETCH, ASSET_PREFETCH_PENDING, ASSET_PREFETCH_BYTES)
+    luaL_setglobalfunction(L, "asset_prefetch", lua_st_asset_prefetch);
+    luaL_setglobalfunction(L, "asset_prefetch_pending", lua_st_asset_prefetch_pending);
+    luaL_setglobalfunction(L, "asset_prefetch_bytes", lua_st_asset_prefetch_bytes);
+
+    // Per-type asset budgets (BASIC: ASSET_SET_BUDGET, ASSET_PIN, ASSET_TYPE_*)
+    luaL_setglobalfunction(L, "asset_set_type_budget", lua_st_asset_set_type_budget);
+    luaL_setglobalfunction(L, "asset_pin", lua_st_asset_pin);
+    luaL_setglobalfunction(L, "asset_unpin", lua_st_asset_unpin);
+    luaL_setglobalfunction(L, "asset_type_hits", lua_st_asset_type_hits);
+    luaL_setglobalfunction(L, "asset_type_misses", lua_st_asset_type_misses);
+    luaL_setglobalfunction(L, "asset_type_evictions", lua_st_asset_type_evictions);
+    luaL_setglobalfunction(L, "asset_type_bytes", lua_st_asset_type_bytes);
+
     // Tilemap API - Create 'tilemap' namespace table
     lua_newtable(L);
 
@@ -6288,6 +9070,25 @@ void registerBindings(lua_State* L) {
     lua_pushcfunction(L, lua_st_tilemap_clear);
     lua_setfield(L, -2, "clear");
 
+    // Bulk region editing
+    lua_pushcfunction(L, lua_st_tilemap_set_region);
+    lua_setfield(L, -2, "setRegion");
+
+    lua_pushcfunction(L, lua_st_tilemap_get_region);
+    lua_setfield(L, -2, "getRegion");
+
+    lua_pushcfunction(L, lua_st_tilemap_get_region_packed);
+    lua_setfield(L, -2, "getRegionPacked");
+
+    lua_pushcfunction(L, lua_st_tilemap_copy_region);
+    lua_setfield(L, -2, "copyRegion");
+
+    lua_pushcfunction(L, lua_st_tilemap_set_row);
+    lua_setfield(L, -2, "setRow");
+
+    lua_pushcfunction(L, lua_st_tilemap_set_column);
+    lua_setfield(L, -2, "setColumn");
+
     // Camera control
     lua_pushcfunction(L, lua_st_tilemap_set_camera);
     lua_setfield(L, -2, "setCamera");
@@ -6340,6 +9141,16 @@ void registerBindings(lua_State* L) {
     // Set the 'tilemap' global table
     lua_setglobal(L, "tilemap");
 
+    // Chunked tilemaps (BASIC: CHUNKMAP_*)
+    luaL_setglobalfunction(L, "chunkmap_create", lua_st_chunkmap_create);
+    luaL_setglobalfunction(L, "chunkmap_destroy", lua_st_chunkmap_destroy);
+    luaL_setglobalfunction(L, "chunkmap_set_camera", lua_st_chunkmap_set_camera);
+    luaL_setglobalfunction(L, "chunkmap_set_tile", lua_st_chunkmap_set_tile);
+    luaL_setglobalfunction(L, "chunkmap_get_tile", lua_st_chunkmap_get_tile);
+    luaL_setglobalfunction(L, "chunkmap_set_region", lua_st_chunkmap_set_region);
+    luaL_setglobalfunction(L, "chunkmap_get_resident", lua_st_chunkmap_get_resident);
+    luaL_setglobalfunction(L, "chunkmap_get_pending", lua_st_chunkmap_get_pending);
+
     // =============================================================================
     // Unified Video Mode API (V-commands)
     // =============================================================================
@@ -6442,6 +9253,10 @@ void registerVoiceBindings(lua_State* L) {
     luaL_setglobalfunction(L, "voice_reset_all", lua_st_voice_reset_all);
     luaL_setglobalfunction(L, "voice_get_active_count", lua_st_voice_get_active_count);
     luaL_setglobalfunction(L, "voices_are_playing", lua_st_voices_are_playing);
+    luaL_setglobalfunction(L, "voice_queue_stats", lua_st_voice_queue_stats);
+    luaL_setglobalfunction(L, "voice_queue_get_depth", lua_st_voice_queue_get_depth);
+    luaL_setglobalfunction(L, "voice_queue_get_coalesced", lua_st_voice_queue_get_coalesced);
+    luaL_setglobalfunction(L, "voice_flush", lua_st_voice_flush);
     
     // Voice Controller API - Rendering
     luaL_setglobalfunction(L, "voice_direct", lua_st_voice_direct);
@@ -6491,6 +9306,43 @@ void registerVoiceBindings(lua_State* L) {
     luaL_setglobalfunction(L, "voices_next_slot", lua_st_voices_next_slot);
     luaL_setglobalfunction(L, "voices_end_play", lua_st_voices_end_play);
     luaL_setglobalfunction(L, "voices_end_save", lua_st_voices_end_save);
+    luaL_setglobalfunction(L, "voices_end_save_async", lua_st_voices_end_save_async);
+    luaL_setglobalfunction(L, "voice_benchmark", lua_st_voice_benchmark);
+    luaL_setglobalfunction(L, "voice_benchmark_cost", lua_st_voice_benchmark_cost);
+    luaL_setglobalfunction(L, "voice_waveform_at", lua_st_voice_waveform_at);
+    luaL_setglobalfunction(L, "voice_envelope_at", lua_st_voice_envelope_at);
+    luaL_setglobalfunction(L, "voice_frequency_at", lua_st_voice_frequency_at);
+    luaL_setglobalfunction(L, "voice_volume_at", lua_st_voice_volume_at);
+    luaL_setglobalfunction(L, "voice_pan_at", lua_st_voice_pan_at);
+    luaL_setglobalfunction(L, "voice_gate_at", lua_st_voice_gate_at);
+    luaL_setglobalfunction(L, "voice_filter_at", lua_st_voice_filter_at);
+    luaL_setglobalfunction(L, "voice_sequence_at", lua_st_voice_sequence_at);
+    luaL_setglobalfunction(L, "render_job_done", lua_st_render_job_done);
+    luaL_setglobalfunction(L, "render_job_result", lua_st_render_job_result);
+}
+
+// =============================================================================
+// Script Lifecycle
+// =============================================================================
+
+void beginScriptRun() {
+    s_explodeFragmentBudget = EXPLODE_DEFAULT_FRAGMENT_BUDGET;
+    soundCacheReset();
+    voiceStagingReset();
+    voiceShadowClear();
+    // A running script has a frame loop and endScriptRun to flush staged writes
+    s_voiceParamStaging = true;
+    assetResidencyReset();
+}
+
+void endScriptRun(lua_State* L) {
+    // Writes made after the last frame wait (a final volume before END)
+    flushVoiceParameters();
+    voiceStagingReset();
+    s_voiceParamStaging = false;
+    renderJobsReset();
+    prefetchReset();
+    chunkMapsReset(L);
 }
 
 } // namespace FBTBindings
@@ -25,6 +25,30 @@ void registerBindings(lua_State* L);
 // Register ONLY voice/audio bindings (for terminal tools - no GUI)
 void registerVoiceBindings(lua_State* L);
 
+// Apply voice parameter writes staged since the last frame
+// (call wherever the runtime waits for the next frame)
+void flushVoiceParameters();
+
+// Load queued ASSET_PREFETCH database entries within a small per-frame budget
+// and publish the asset cache counters for assetCacheReport
+// (call alongside flushVoiceParameters when waiting for the next frame)
+void pumpAssetPrefetch();
+
+// Per-type asset residency table (resident bytes, budget, hits, misses,
+// evictions) formatted for the REPL's ASSET STATS command. Safe to call from
+// any thread; reflects the counters as of the script's last frame
+std::vector<std::string> assetCacheReport();
+
+// Reset per-run binding state to its defaults (call before a script starts)
+void beginScriptRun();
+
+// Release per-run binding state: applies voice parameter writes staged
+// after the last frame, joins outstanding background renders, and destroys
+// chunk maps along with their generator references.
+// Call on every exit path (END, stop, runtime error, normal completion)
+// while L, the state the script ran in, is still open
+void endScriptRun(lua_State* L);
+
 // Initialize DATA manager with compiled DATA values (parsed into typed variants)
 void initializeDataManager(const std::vector<std::string>& values);
 
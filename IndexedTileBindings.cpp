@@ -10,6 +10,7 @@
 #include "../Framework/Tilemap/TilemapIndexedAPI.h"
 #include <lua.hpp>
 #include <cstring>
+#include <vector>
 
 namespace SuperTerminal {
 namespace IndexedTileBindings {
@@ -392,6 +393,116 @@ static int lua_tilemapex_clear(lua_State* L) {
     return 0;
 }
 
+// tilemapex_set_region(tilemap, x, y, width, height, tiles [, palettes, start])
+// Writes a row-major rectangle of tile IDs (and optional palette indices) in
+// one call; arrays are read from index start (default 0, as BASIC arrays)
+static int lua_tilemapex_set_region(lua_State* L) {
+    TilemapExHandle tilemap = (TilemapExHandle)lua_touserdata(L, 1);
+    int32_t x = luaL_checkinteger(L, 2);
+    int32_t y = luaL_checkinteger(L, 3);
+    int32_t width = luaL_checkinteger(L, 4);
+    int32_t height = luaL_checkinteger(L, 5);
+    luaL_checktype(L, 6, LUA_TTABLE);
+    bool hasPalettes = lua_istable(L, 7);
+    int start = luaL_optinteger(L, 8, 0);
+
+    int index = start;
+    for (int32_t row = 0; row < height; row++) {
+        for (int32_t col = 0; col < width; col++, index++) {
+            lua_rawgeti(L, 6, index);
+            uint16_t tileId = (uint16_t)lua_tointeger(L, -1);
+            lua_pop(L, 1);
+
+            uint8_t paletteIndex = 0;
+            if (hasPalettes) {
+                lua_rawgeti(L, 7, index);
+                paletteIndex = (uint8_t)lua_tointeger(L, -1);
+                lua_pop(L, 1);
+            }
+
+            tilemapex_set_tile_indexed(tilemap, x + col, y + row, tileId, paletteIndex,
+                                       3, false, false, 0); // TILEEX_ZORDER_NORMAL
+        }
+    }
+    return 0;
+}
+
+// tilemapex_get_region(tilemap, x, y, width, height, tiles [, palettes, start])
+static int lua_tilemapex_get_region(lua_State* L) {
+    TilemapExHandle tilemap = (TilemapExHandle)lua_touserdata(L, 1);
+    int32_t x = luaL_checkinteger(L, 2);
+    int32_t y = luaL_checkinteger(L, 3);
+    int32_t width = luaL_checkinteger(L, 4);
+    int32_t height = luaL_checkinteger(L, 5);
+    luaL_checktype(L, 6, LUA_TTABLE);
+    bool hasPalettes = lua_istable(L, 7);
+    int start = luaL_optinteger(L, 8, 0);
+
+    int index = start;
+    for (int32_t row = 0; row < height; row++) {
+        for (int32_t col = 0; col < width; col++, index++) {
+            uint16_t tileId = 0;
+            uint8_t paletteIndex = 0, zOrder, rotation;
+            bool flipX, flipY;
+            tilemapex_get_tile_indexed(tilemap, x + col, y + row, &tileId, &paletteIndex,
+                                       &zOrder, &flipX, &flipY, &rotation);
+
+            lua_pushinteger(L, tileId);
+            lua_rawseti(L, 6, index);
+            if (hasPalettes) {
+                lua_pushinteger(L, paletteIndex);
+                lua_rawseti(L, 7, index);
+            }
+        }
+    }
+    return 0;
+}
+
+// tilemapex_copy_region(src, x, y, width, height, dst, dstX, dstY)
+// Copies every tile attribute; the source is read first, so overlapping
+// copies within one tilemap are safe
+static int lua_tilemapex_copy_region(lua_State* L) {
+    TilemapExHandle src = (TilemapExHandle)lua_touserdata(L, 1);
+    int32_t x = luaL_checkinteger(L, 2);
+    int32_t y = luaL_checkinteger(L, 3);
+    int32_t width = luaL_checkinteger(L, 4);
+    int32_t height = luaL_checkinteger(L, 5);
+    TilemapExHandle dst = (TilemapExHandle)lua_touserdata(L, 6);
+    int32_t dstX = luaL_checkinteger(L, 7);
+    int32_t dstY = luaL_checkinteger(L, 8);
+    if (!src || !dst || width <= 0 || height <= 0) {
+        return 0;
+    }
+
+    struct TileCell {
+        uint16_t tileId;
+        uint8_t paletteIndex, zOrder, rotation;
+        bool flipX, flipY, valid;
+    };
+    std::vector<TileCell> cells((size_t)width * height);
+
+    size_t i = 0;
+    for (int32_t row = 0; row < height; row++) {
+        for (int32_t col = 0; col < width; col++, i++) {
+            TileCell& cell = cells[i];
+            cell.valid = tilemapex_get_tile_indexed(src, x + col, y + row, &cell.tileId, &cell.paletteIndex,
+                                                    &cell.zOrder, &cell.flipX, &cell.flipY, &cell.rotation);
+        }
+    }
+
+    i = 0;
+    for (int32_t row = 0; row < height; row++) {
+        for (int32_t col = 0; col < width; col++, i++) {
+            const TileCell& cell = cells[i];
+            if (cell.valid) {
+                tilemapex_set_tile_indexed(dst, dstX + col, dstY + row, cell.tileId, cell.paletteIndex,
+                                           cell.zOrder, cell.flipX, cell.flipY, cell.rotation);
+            }
+        }
+    }
+    return 0;
+}
+
 static int lua_tilemapex_get_info(lua_State* L) {
     TilemapExHandle tilemap = (TilemapExHandle)lua_touserdata(L, 1);
     
@@ -450,6 +561,9 @@ void registerBindings(lua_State* L) {
     lua_register(L, "tilemapex_fill", lua_tilemapex_fill);
     lua_register(L, "tilemapex_fill_rect", lua_tilemapex_fill_rect);
     lua_register(L, "tilemapex_clear", lua_tilemapex_clear);
+    lua_register(L, "tilemapex_set_region", lua_tilemapex_set_region);
+    lua_register(L, "tilemapex_get_region", lua_tilemapex_get_region);
+    lua_register(L, "tilemapex_copy_region", lua_tilemapex_copy_region);
     lua_register(L, "tilemapex_get_info", lua_tilemapex_get_info);
 }
 
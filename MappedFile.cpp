@@ -0,0 +1,87 @@
+// =============================================================================
+// MappedFile.cpp
+// =============================================================================
+// Read-only memory-mapped file implementation (POSIX mmap)
+
+#include "MappedFile.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace SuperTerminal {
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(other.m_data)
+    , m_size(other.m_size)
+    , m_open(other.m_open)
+{
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_open = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_open, other.m_open);
+    }
+    return *this;
+}
+
+bool MappedFile::open(const std::string& path) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return false;
+    }
+
+    m_size = static_cast<size_t>(st.st_size);
+    if (m_size > 0) {
+        void* mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            m_size = 0;
+            return false;
+        }
+        m_data = static_cast<const uint8_t*>(mapping);
+    }
+
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    m_open = true;
+    return true;
+}
+
+void MappedFile::close() {
+    if (m_data) {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_open = false;
+}
+
+void MappedFile::adviseSequential(size_t offset, size_t length) const {
+    if (!m_data || offset >= m_size) {
+        return;
+    }
+    // madvise wants a page-aligned start
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t start = offset & ~(page - 1);
+    size_t end = offset + length < m_size ? offset + length : m_size;
+    madvise(const_cast<uint8_t*>(m_data) + start, end - start, MADV_SEQUENTIAL);
+    madvise(const_cast<uint8_t*>(m_data) + start, end - start, MADV_WILLNEED);
+}
+
+} // namespace SuperTerminal
@@ -0,0 +1,46 @@
+// =============================================================================
+// MappedFile.h
+// =============================================================================
+// Read-only memory-mapped file for loading carts, assets and sources without
+// copying them into heap buffers. Pages are faulted in on first touch, so
+// opening a large file costs nothing until its bytes are actually read.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace SuperTerminal {
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path) { open(path); }
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /// Map the whole file read-only. Returns false (and leaves the object
+    /// empty) if the file cannot be opened or mapped. Empty files succeed
+    /// with size() == 0.
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return m_open; }
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+    /// Hint that [offset, offset + length) will be read front to back soon
+    void adviseSequential(size_t offset, size_t length) const;
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_open = false;
+};
+
+} // namespace SuperTerminal
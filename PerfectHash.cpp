@@ -0,0 +1,108 @@
+// =============================================================================
+// PerfectHash.cpp
+// =============================================================================
+// Hash-and-displace construction for PerfectHashIndex
+
+#include "PerfectHash.h"
+#include <algorithm>
+
+namespace SuperTerminal {
+
+void PerfectHashIndex::build(const std::vector<std::string>& keys) {
+    m_seeds.clear();
+    m_slots.clear();
+    m_keyCount = 0;
+
+    // Drop case-insensitive duplicates, keeping the first occurrence
+    std::vector<int32_t> unique;
+    {
+        std::vector<std::string> folded;
+        folded.reserve(keys.size());
+        for (size_t i = 0; i < keys.size(); i++) {
+            std::string key = keys[i];
+            std::transform(key.begin(), key.end(), key.begin(), foldIdentifierChar);
+            folded.push_back(std::move(key));
+        }
+        std::vector<size_t> order(keys.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [&](size_t a, size_t b) { return folded[a] < folded[b]; });
+        for (size_t i = 0; i < order.size(); i++) {
+            if (i == 0 || folded[order[i]] != folded[order[i - 1]]) {
+                unique.push_back(static_cast<int32_t>(order[i]));
+            }
+        }
+    }
+
+    m_keyCount = unique.size();
+    if (m_keyCount == 0) {
+        return;
+    }
+
+    const size_t bucketCount = std::max<size_t>(1, m_keyCount / 3);
+    const size_t slotCount = m_keyCount + m_keyCount / 4 + 1;
+    m_seeds.assign(bucketCount, 0);
+    m_slots.assign(slotCount, Slot());
+
+    std::vector<std::vector<int32_t>> buckets(bucketCount);
+    for (int32_t index : unique) {
+        buckets[foldedNameHash(keys[index]) % bucketCount].push_back(index);
+    }
+
+    // Place the largest buckets first while the table is emptiest
+    std::vector<size_t> bucketOrder(bucketCount);
+    for (size_t i = 0; i < bucketCount; i++) {
+        bucketOrder[i] = i;
+    }
+    std::stable_sort(bucketOrder.begin(), bucketOrder.end(),
+                     [&](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+    std::vector<size_t> placed;
+    for (size_t bucket : bucketOrder) {
+        const std::vector<int32_t>& members = buckets[bucket];
+        if (members.empty()) {
+            break;
+        }
+
+        for (uint32_t seed = 1;; seed++) {
+            placed.clear();
+            bool ok = true;
+            for (int32_t index : members) {
+                size_t slot = foldedNameHash(keys[index], seed) % slotCount;
+                if (m_slots[slot].value != NOT_FOUND ||
+                    std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+                    ok = false;
+                    break;
+                }
+                placed.push_back(slot);
+            }
+            if (ok) {
+                m_seeds[bucket] = seed;
+                for (size_t i = 0; i < members.size(); i++) {
+                    m_slots[placed[i]].key = keys[members[i]];
+                    m_slots[placed[i]].value = members[i];
+                }
+                break;
+            }
+        }
+    }
+}
+
+int32_t PerfectHashIndex::find(std::string_view name) const {
+    if (m_keyCount == 0) {
+        return NOT_FOUND;
+    }
+    uint32_t seed = m_seeds[foldedNameHash(name) % m_seeds.size()];
+    if (seed == 0) {
+        return NOT_FOUND;
+    }
+    const Slot& slot = m_slots[foldedNameHash(name, seed) % m_slots.size()];
+    if (slot.value != NOT_FOUND && identifierEquals(slot.key, name)) {
+        return slot.value;
+    }
+    return NOT_FOUND;
+}
+
+} // namespace SuperTerminal
@@ -0,0 +1,80 @@
+// =============================================================================
+// PerfectHash.h
+// =============================================================================
+// Case-insensitive perfect-hash index over a fixed set of BASIC identifiers.
+//
+// The key set is known once (registry names, keywords, constants), so the
+// index is built with hash-and-displace: keys are grouped into buckets and
+// each bucket gets a seed that sends all of its keys to distinct slots.
+// A lookup is then one hash, one displacement read and one key compare -
+// no probing, no chains, and no uppercase copy of the word being looked up.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace SuperTerminal {
+
+/// ASCII case fold used for BASIC identifiers
+constexpr char foldIdentifierChar(char c) {
+    return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+}
+
+/// FNV-1a over the case-folded name, mixed with a seed. constexpr so fixed
+/// keyword tables can be hashed at compile time.
+constexpr uint32_t foldedNameHash(std::string_view name, uint32_t seed = 0) {
+    uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (char c : name) {
+        hash ^= static_cast<uint8_t>(foldIdentifierChar(c));
+        hash *= 16777619u;
+    }
+    hash ^= hash >> 15;
+    hash *= 0x2C1B3C6Du;
+    hash ^= hash >> 12;
+    return hash;
+}
+
+/// Case-insensitive equality for identifiers
+constexpr bool identifierEquals(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        if (foldIdentifierChar(a[i]) != foldIdentifierChar(b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+class PerfectHashIndex {
+public:
+    static constexpr int32_t NOT_FOUND = -1;
+
+    /// Build over keys; find() returns the position of a key in this vector.
+    /// Keys that differ only by case collapse to their first occurrence.
+    void build(const std::vector<std::string>& keys);
+
+    /// Position of name in the build() vector, or NOT_FOUND
+    int32_t find(std::string_view name) const;
+
+    bool contains(std::string_view name) const { return find(name) != NOT_FOUND; }
+    size_t size() const { return m_keyCount; }
+    bool empty() const { return m_keyCount == 0; }
+
+private:
+    struct Slot {
+        std::string key;
+        int32_t value = NOT_FOUND;
+    };
+
+    std::vector<uint32_t> m_seeds;   // per bucket
+    std::vector<Slot> m_slots;
+    size_t m_keyCount = 0;
+};
+
+} // namespace SuperTerminal
@@ -0,0 +1,139 @@
+//
+// ProgramListing.cpp
+// FBRunner3 - Streaming program listings
+//
+
+#include "ProgramListing.h"
+#include "../FasterBASICT/src/SourceDocument.h"
+#include <cctype>
+#include <charconv>
+#include <ostream>
+
+namespace FBRunner3 {
+
+// =============================================================================
+// Range Parsing
+// =============================================================================
+
+static bool parseLineNumber(const std::string& text, size_t& pos, int& value) {
+    size_t start = pos;
+    while (pos < text.size() && std::isdigit(static_cast<unsigned char>(text[pos]))) {
+        pos++;
+    }
+    if (pos == start) {
+        return false;
+    }
+    auto result = std::from_chars(text.data() + start, text.data() + pos, value);
+    return result.ec == std::errc();
+}
+
+bool ListingRange::parse(const std::string& args, ListingRange& range) {
+    range = ListingRange();
+
+    size_t pos = 0;
+    auto skipSpaces = [&]() {
+        while (pos < args.size() && std::isspace(static_cast<unsigned char>(args[pos]))) {
+            pos++;
+        }
+    };
+
+    skipSpaces();
+    if (pos == args.size()) {
+        return true;                        // LIST
+    }
+
+    bool hasFirst = parseLineNumber(args, pos, range.first);
+    skipSpaces();
+    if (pos < args.size() && (args[pos] == '-' || args[pos] == ',')) {
+        pos++;
+        skipSpaces();
+        if (pos < args.size() && !parseLineNumber(args, pos, range.last)) {
+            return false;
+        }
+    } else if (hasFirst) {
+        range.last = range.first;           // LIST 100
+    } else {
+        return false;
+    }
+
+    skipSpaces();
+    return pos == args.size() && range.first <= range.last;
+}
+
+// =============================================================================
+// Streaming
+// =============================================================================
+
+size_t streamProgramListing(const FasterBASIC::SourceDocument& document,
+                            const ListingRange& range,
+                            const ListingSink& sink,
+                            size_t chunkBytes) {
+    size_t lineCount = document.getLineCount();
+
+    // Unnumbered (0) lines are not part of a listing and do not order with
+    // the rest; drop them from the end so they never end the walk below
+    while (lineCount > 0 && document.getLineByIndex(lineCount - 1).lineNumber <= 0) {
+        lineCount--;
+    }
+
+    // Numbered lines ascend through the document, so the first line in range
+    // is a binary search away. A probe that lands on an unnumbered line
+    // compares the nearest numbered line before it instead.
+    size_t low = 0;
+    size_t high = lineCount;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        size_t probe = mid;
+        while (probe > low && document.getLineByIndex(probe).lineNumber <= 0) {
+            probe--;
+        }
+        int lineNumber = document.getLineByIndex(probe).lineNumber;
+        if (lineNumber <= 0 || lineNumber < range.first) {
+            low = mid + 1;
+        } else {
+            high = probe;
+        }
+    }
+
+    std::string buffer;
+    buffer.reserve(chunkBytes + 256);
+    char number[16];
+    size_t written = 0;
+
+    for (size_t i = low; i < lineCount; ++i) {
+        const auto& line = document.getLineByIndex(i);
+        if (line.lineNumber > range.last) {
+            break;
+        }
+        if (line.lineNumber <= 0) {
+            continue;                       // Unnumbered lines are not part of a listing
+        }
+
+        auto result = std::to_chars(number, number + sizeof(number), line.lineNumber);
+        buffer.append(number, result.ptr);
+        buffer.push_back(' ');
+        buffer.append(line.text);
+        buffer.push_back('\n');
+        written++;
+
+        if (buffer.size() >= chunkBytes) {
+            sink(buffer);
+            buffer.clear();
+        }
+    }
+
+    if (!buffer.empty()) {
+        sink(buffer);
+    }
+    return written;
+}
+
+size_t streamProgramListing(const FasterBASIC::SourceDocument& document,
+                            const ListingRange& range,
+                            std::ostream& out) {
+    return streamProgramListing(document, range, [&out](const std::string& chunk) {
+        out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    });
+}
+
+} // namespace FBRunner3
@@ -0,0 +1,54 @@
+//
+// ProgramListing.h
+// FBRunner3 - Streaming program listings
+//
+// LIST and SAVE write "<line number> <code>" for every program line. Rather
+// than building a vector of formatted lines and then a second copy of the
+// whole program, the listing is formatted straight out of the program's
+// SourceDocument into one reusable buffer and handed to the destination in
+// chunks. LIST ranges are found by binary search on the (ascending) line
+// numbers, so listing a few lines of a large program touches only those.
+//
+
+#pragma once
+
+#include <climits>
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+
+namespace FasterBASIC {
+    class SourceDocument;
+}
+
+namespace FBRunner3 {
+
+/// Inclusive range of BASIC line numbers
+struct ListingRange {
+    int first = 0;
+    int last = INT_MAX;
+
+    /// Parse LIST arguments: "", "100", "100-200", "100-" or "-200"
+    /// @return false if args is not a line range
+    static bool parse(const std::string& args, ListingRange& range);
+};
+
+/// Receives formatted listing text; every chunk ends on a line boundary
+using ListingSink = std::function<void(const std::string& chunk)>;
+
+/// Stream numbered lines of document within range to sink
+/// @param chunkBytes Buffer size handed to sink at a time
+/// @return Number of lines written
+size_t streamProgramListing(const FasterBASIC::SourceDocument& document,
+                            const ListingRange& range,
+                            const ListingSink& sink,
+                            size_t chunkBytes = 64 * 1024);
+
+/// Stream numbered lines of document within range to out
+/// @return Number of lines written
+size_t streamProgramListing(const FasterBASIC::SourceDocument& document,
+                            const ListingRange& range,
+                            std::ostream& out);
+
+} // namespace FBRunner3
@@ -0,0 +1,121 @@
+//
+// ProgramLoader.cpp
+// FBRunner3 - Bulk program loading
+//
+
+#include "ProgramLoader.h"
+#include "MappedFile.h"
+#include "../FasterBASICT/shell/program_manager_v2.h"
+#include "../FasterBASICT/src/SourceDocument.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+namespace FBRunner3 {
+
+static bool isBlank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+std::vector<ProgramTextLine> parseProgramText(std::string_view text) {
+    const char* cursor = text.data();
+    const char* end = text.data() + text.size();
+
+    // Size the line array once; memchr is vectorized by the C library
+    size_t newlines = 0;
+    for (const char* p = cursor; p < end; ++newlines) {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        if (!nl) {
+            break;
+        }
+        p = nl + 1;
+    }
+
+    std::vector<ProgramTextLine> lines;
+    lines.reserve(newlines + 1);
+    bool ordered = true;
+
+    while (cursor < end) {
+        const char* nl = static_cast<const char*>(std::memchr(cursor, '\n', static_cast<size_t>(end - cursor)));
+        const char* lineEnd = nl ? nl : end;
+        const char* next = nl ? nl + 1 : end;
+        if (lineEnd > cursor && lineEnd[-1] == '\r') {
+            --lineEnd;
+        }
+
+        const char* p = cursor;
+        cursor = next;
+
+        while (p < lineEnd && isBlank(*p)) {
+            ++p;
+        }
+        if (p == lineEnd || *p == '#') {
+            continue;
+        }
+
+        int lineNumber = 0;
+        auto parsed = std::from_chars(p, lineEnd, lineNumber);
+        if (parsed.ec != std::errc() || parsed.ptr == p || lineNumber <= 0) {
+            continue;
+        }
+        // One separator, as streamProgramListing writes it; any further
+        // indentation and trailing blanks belong to the code
+        p = parsed.ptr;
+        if (p < lineEnd && isBlank(*p)) {
+            ++p;
+        }
+        if (std::all_of(p, lineEnd, isBlank)) {
+            continue;
+        }
+
+        if (!lines.empty() && lineNumber <= lines.back().lineNumber) {
+            ordered = false;
+        }
+        lines.push_back({lineNumber, std::string_view(p, static_cast<size_t>(lineEnd - p))});
+    }
+
+    if (!ordered) {
+        // Stable sort keeps file order within a number; keep the last of each
+        std::stable_sort(lines.begin(), lines.end(),
+                         [](const ProgramTextLine& a, const ProgramTextLine& b) {
+                             return a.lineNumber < b.lineNumber;
+                         });
+        size_t out = 0;
+        for (size_t i = 0; i < lines.size(); ++i) {
+            if (i + 1 < lines.size() && lines[i + 1].lineNumber == lines[i].lineNumber) {
+                continue;
+            }
+            lines[out++] = lines[i];
+        }
+        lines.resize(out);
+    }
+
+    return lines;
+}
+
+ProgramLoadResult loadProgramFile(const std::string& path, FasterBASIC::ProgramManagerV2& program) {
+    ProgramLoadResult result;
+
+    SuperTerminal::MappedFile file;
+    if (!file.open(path)) {
+        result.error = "Cannot open file: " + path;
+        return result;
+    }
+    file.adviseSequential(0, file.size());
+
+    std::string_view text(reinterpret_cast<const char*>(file.data()), file.size());
+    std::vector<ProgramTextLine> lines = parseProgramText(text);
+
+    // Lines arrive in order, so every insert is an append
+    program.clear();
+    FasterBASIC::SourceDocument& document = *program.getDocument();
+    for (const auto& line : lines) {
+        document.insertLineAtIndex(document.getLineCount(), std::string(line.code), line.lineNumber);
+    }
+
+    result.success = true;
+    result.lineCount = lines.size();
+    return result;
+}
+
+} // namespace FBRunner3
@@ -0,0 +1,53 @@
+//
+// ProgramLoader.h
+// FBRunner3 - Bulk program loading
+//
+// LOAD used to read a file line by line, run the full shell CommandParser on
+// every line and insert each one into the program individually (each insert
+// searching for its place). The bulk loader maps the file, splits it with
+// memchr, peels off line numbers with a plain digit scan into one
+// pre-sized array of views, and appends the lines to the program's
+// SourceDocument in order. Files that are already in line-number order (the
+// normal case) need no sort; others are sorted once, and a repeated line
+// number keeps its last definition, as if the lines had been typed.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace FasterBASIC {
+    class ProgramManagerV2;
+}
+
+namespace FBRunner3 {
+
+/// One numbered line found in program text (views into the source buffer)
+struct ProgramTextLine {
+    int lineNumber;
+    std::string_view code;
+};
+
+/// Split program text into numbered lines. Blank lines, '#' comments and
+/// lines without a line number or without code are skipped; CR/LF endings
+/// are accepted. One blank after the line number is taken as the separator;
+/// the rest of the line, indentation and trailing blanks included, is code.
+/// Result is sorted by line number with duplicates resolved to the last
+/// definition.
+std::vector<ProgramTextLine> parseProgramText(std::string_view text);
+
+/// Result of loading a program file
+struct ProgramLoadResult {
+    bool success = false;
+    size_t lineCount = 0;
+    std::string error;
+};
+
+/// Replace the program with the numbered lines of the file. The program is
+/// left untouched if the file cannot be opened.
+ProgramLoadResult loadProgramFile(const std::string& path, FasterBASIC::ProgramManagerV2& program);
+
+} // namespace FBRunner3
@@ -19,6 +19,9 @@
 #include "../FasterBASICT/src/fasterbasic_lua_codegen.h"
 #include "../FasterBASICT/src/basic_formatter_lib.h"
 #include "../FasterBASICT/runtime/DataManager.h"
+#include "../FasterBASICT/src/SourceDocument.h"
+#include "ProgramListing.h"
+#include "ProgramLoader.h"
 
 #include <filesystem>
 #include <fstream>
@@ -318,14 +321,21 @@ bool ShellAdapter::handleProgramLine(int lineNumber, const std::string& code) {
 }
 
 bool ShellAdapter::handleListCommand(const std::string& args) {
-    std::string listing = formatProgramListing();
-    
-    if (listing.empty()) {
+    if (programManager_->isEmpty()) {
         outputLine("No program in memory");
-    } else {
-        output(listing);
+        return true;
+    }
+    
+    FBRunner3::ListingRange range;
+    if (!FBRunner3::ListingRange::parse(args, range)) {
+        error("Invalid line range");
+        return false;
     }
     
+    // Formatted in chunks straight from the program; no full copy is built
+    FBRunner3::streamProgramListing(*programManager_->getDocument(), range,
+                                    [this](const std::string& chunk) { output(chunk); });
+    
     return true;
 }
 
@@ -362,44 +372,14 @@ bool ShellAdapter::handleLoadCommand(const std::string& filename) {
         return false;
     }
     
-    std::ifstream file(fullPath);
-    if (!file.is_open()) {
+    // Map the file and build the program in one pass
+    FBRunner3::ProgramLoadResult loaded = FBRunner3::loadProgramFile(fullPath, *programManager_);
+    if (!loaded.success) {
         error("Cannot open file: " + filename);
         return false;
     }
     
-    // Clear current program
-    programManager_->clear();
-    
-    // Load lines
-    std::string line;
-    int lineCount = 0;
-    
-    while (std::getline(file, line)) {
-        if (line.empty() || line[0] == '#') continue;
-        
-        std::istringstream iss(line);
-        int lineNum;
-        
-        if (iss >> lineNum) {
-            std::string code;
-            std::getline(iss, code);
-            
-            // Remove leading space
-            if (!code.empty() && code[0] == ' ') {
-                code = code.substr(1);
-            }
-            
-            if (!code.empty()) {
-                programManager_->setLine(lineNum, code);
-                lineCount++;
-            }
-        }
-    }
-    
-    file.close();
-    
-    outputLine("Loaded " + std::to_string(lineCount) + " lines from " + filename);
+    outputLine("Loaded " + std::to_string(loaded.lineCount) + " lines from " + filename);
     programManager_->setModified(false);
     
     return true;
@@ -425,13 +405,13 @@ bool ShellAdapter::handleSaveCommand(const std::string& filename) {
     }
     
     // Write program
-    auto lines = programManager_->getLineNumbers();
-    for (int lineNum : lines) {
-        std::string code = programManager_->getLine(lineNum);
-        file << lineNum << " " << code << "\n";
-    }
+    FBRunner3::streamProgramListing(*programManager_->getDocument(), FBRunner3::ListingRange(), file);
     
     file.close();
+    if (!file) {
+        error("Cannot write file: " + filename);
+        return false;
+    }
     
     outputLine("Saved to " + filename);
     programManager_->setModified(false);
@@ -834,33 +814,16 @@ std::vector<std::string> ShellAdapter::listBasicFiles() const {
 // =============================================================================
 
 std::string ShellAdapter::formatProgramListing() const {
-    auto lines = programManager_->getLineNumbers();
-    
-    if (lines.empty()) {
-        return "";
-    }
-    
-    std::ostringstream oss;
-    
-    for (int lineNum : lines) {
-        std::string code = programManager_->getLine(lineNum);
-        oss << lineNum << " " << code << "\n";
-    }
-    
-    return oss.str();
+    return formatLineRange(0, INT_MAX);
 }
 
 std::string ShellAdapter::formatLineRange(int start, int end) const {
-    auto lines = programManager_->getLineNumbers();
-    
-    std::ostringstream oss;
-    
-    for (int lineNum : lines) {
-        if (lineNum >= start && lineNum <= end) {
-            std::string code = programManager_->getLine(lineNum);
-            oss << lineNum << " " << code << "\n";
-        }
-    }
-    
-    return oss.str();
+    FBRunner3::ListingRange range;
+    range.first = start;
+    range.last = end;
+    
+    std::string listing;
+    FBRunner3::streamProgramListing(*programManager_->getDocument(), range,
+                                    [&listing](const std::string& chunk) { listing += chunk; });
+    return listing;
 }
\ No newline at end of file
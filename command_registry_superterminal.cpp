@@ -541,6 +541,26 @@ void SuperTerminalCommandRegistry::registerMusicCommands(CommandRegistry& regist
     musicSaveToWav.addParameter("duration", ParameterType::FLOAT, "Duration in seconds (0 = auto)", true);
     registry.registerCommand(std::move(musicSaveToWav));
 
+    // MUSIC_RENDER_WAV_ASYNC - Render a music file to WAV on a worker thread
+    CommandDefinition musicRenderWavAsync("MUSIC_RENDER_WAV_ASYNC",
+                                          "Render a music file to WAV in the background, returning a render job ID",
+                                          "st_music_render_to_wav_async", "audio", false, ReturnType::INT);
+    musicRenderWavAsync.addParameter("path", ParameterType::STRING, "Music file path");
+    musicRenderWavAsync.addParameter("output_path", ParameterType::STRING, "Output WAV path");
+    musicRenderWavAsync.addParameter("format", ParameterType::STRING, "Music format (empty = detect from file)", true, "\"\"");
+    musicRenderWavAsync.addParameter("fast_render", ParameterType::INT, "Render faster than real time (0 = no, 1 = yes)", true, "0");
+    registry.registerFunction(std::move(musicRenderWavAsync));
+
+    // MUSIC_RENDER_SLOT_ASYNC - Render a music file into a sound bank slot on a worker thread
+    CommandDefinition musicRenderSlotAsync("MUSIC_RENDER_SLOT_ASYNC",
+                                           "Render a music file to a sound bank slot in the background, returning a render job ID",
+                                           "st_music_render_to_slot_async", "audio", false, ReturnType::INT);
+    musicRenderSlotAsync.addParameter("path", ParameterType::STRING, "Music file path");
+    musicRenderSlotAsync.addParameter("slot", ParameterType::INT, "Sound bank slot number");
+    musicRenderSlotAsync.addParameter("format", ParameterType::STRING, "Music format (empty = detect from file)", true, "\"\"");
+    musicRenderSlotAsync.addParameter("fast_render", ParameterType::INT, "Render faster than real time (0 = no, 1 = yes)", true, "0");
+    registry.registerFunction(std::move(musicRenderSlotAsync));
+
     // VSCRIPT_SAVE_TO_BANK - Render VoiceScript to sound bank
     CommandDefinition vscriptSaveToBank("VSCRIPT_SAVE_TO_BANK",
                                         "Render VoiceScript and save to sound bank",
@@ -1083,6 +1103,16 @@ void SuperTerminalCommandRegistry::registerVoiceCommands(CommandRegistry& regist
     voiceGateAt.addParameter("state", ParameterType::INT, "Gate state (0=off, 1=on)");
     registry.registerCommand(std::move(voiceGateAt));
 
+    // VOICE_SEQUENCE_AT - Schedule a phrase of notes starting at a beat
+    CommandDefinition voiceSequenceAt("VOICE_SEQUENCE_AT",
+                                      "Schedule a space separated note phrase (\"C4 E4 G4 _ -\") from a beat position, returning the end beat",
+                                      "voice_sequence_at", "audio", false, ReturnType::FLOAT);
+    voiceSequenceAt.addParameter("voice", ParameterType::INT, "Voice number (1-8)");
+    voiceSequenceAt.addParameter("beat", ParameterType::FLOAT, "Beat position of the first step");
+    voiceSequenceAt.addParameter("step", ParameterType::FLOAT, "Beats per step");
+    voiceSequenceAt.addParameter("notes", ParameterType::STRING, "Notes: names like C4 or F#3, - for rest, _ to hold");
+    registry.registerFunction(std::move(voiceSequenceAt));
+
     // VOICE_MASTER_VOLUME - Set master volume
     CommandDefinition voiceMasterVolume("VOICE_MASTER_VOLUME",
                                         "Set voice master volume",
@@ -1096,6 +1126,12 @@ void SuperTerminalCommandRegistry::registerVoiceCommands(CommandRegistry& regist
                                     "voice_reset_all", "audio");
     registry.registerCommand(std::move(voiceResetAll));
 
+    // VOICE_FLUSH - Apply staged voice parameter changes now instead of at the next frame
+    CommandDefinition voiceFlush("VOICE_FLUSH",
+                                 "Apply pending voice parameter changes immediately",
+                                 "voice_flush", "audio");
+    registry.registerCommand(std::move(voiceFlush));
+
     // WAIT - Wait for N/60 seconds (N is in 60ths of a second, like 60 FPS frames)
     // Only for batch mode (fbsh_voices) - provides simple timing control
     CommandDefinition wait("WAIT",
@@ -1159,6 +1195,27 @@ void SuperTerminalCommandRegistry::registerVoiceCommands(CommandRegistry& regist
     voicesEndSave.addParameter("filename", ParameterType::STRING, "Output WAV filename");
     registry.registerCommand(std::move(voicesEndSave));
 
+    // VOICES_END_SAVE_ASYNC - Render timeline to WAV file on a worker thread
+    CommandDefinition voicesEndSaveAsync("VOICES_END_SAVE_ASYNC",
+                                         "Render voice timeline to WAV file in the background, returning a render job ID",
+                                         "voices_end_save_async", "audio", false, ReturnType::INT);
+    voicesEndSaveAsync.addParameter("filename", ParameterType::STRING, "Output WAV filename");
+    registry.registerFunction(std::move(voicesEndSaveAsync));
+
+    // RENDER_JOB_DONE - Check whether a background render job has finished
+    CommandDefinition renderJobDone("RENDER_JOB_DONE",
+                                    "Check whether a background render job has finished",
+                                    "render_job_done", "audio", false, ReturnType::BOOL);
+    renderJobDone.addParameter("job_id", ParameterType::INT, "Render job ID");
+    registry.registerFunction(std::move(renderJobDone));
+
+    // RENDER_JOB_RESULT - Wait for a render job and return its result
+    CommandDefinition renderJobResult("RENDER_JOB_RESULT",
+                                      "Wait for a background render job and return its result (1/0 for WAV, slot for slot renders)",
+                                      "render_job_result", "audio", false, ReturnType::INT);
+    renderJobResult.addParameter("job_id", ParameterType::INT, "Render job ID");
+    registry.registerFunction(std::move(renderJobResult));
+
     // VOICE_DIRECT - Direct audio output to WAV file or live playback
     CommandDefinition voiceDirect("VOICE_DIRECT",
                                   "Direct voice output to WAV file for rendering or empty for live playback",
@@ -1412,6 +1469,34 @@ void SuperTerminalCommandRegistry::registerVoiceFunctions(CommandRegistry& regis
                                        "Check if VOICES_END_PLAY buffer is currently playing",
                                        "voices_are_playing", "audio", false, ReturnType::INT);
     registry.registerFunction(std::move(voicesArePlaying));
+
+    // VOICE_QUEUE_DEPTH - Number of staged voice parameter writes awaiting the next frame
+    CommandDefinition voiceQueueDepth("VOICE_QUEUE_DEPTH",
+                                      "Get number of voice parameter changes waiting for the next frame",
+                                      "voice_queue_get_depth", "audio", false, ReturnType::INT);
+    registry.registerFunction(std::move(voiceQueueDepth));
+
+    // VOICE_QUEUE_COALESCED - Voice parameter writes merged into a later write
+    CommandDefinition voiceQueueCoalesced("VOICE_QUEUE_COALESCED",
+                                          "Get number of voice parameter writes replaced by a later write in the same frame",
+                                          "voice_queue_get_coalesced", "audio", false, ReturnType::INT);
+    registry.registerFunction(std::move(voiceQueueCoalesced));
+
+    // VOICE_BENCHMARK - Time an offline render of N voices (returns realtime factor)
+    CommandDefinition voiceBenchmark("VOICE_BENCHMARK",
+                                     "Render N sustained voices offline and return how many times faster than realtime it ran (CPU time; voice settings are restored afterwards)",
+                                     "voice_benchmark", "audio", false, ReturnType::FLOAT);
+    voiceBenchmark.addParameter("voices", ParameterType::INT, "Number of voices (1-8)")
+                  .addParameter("seconds", ParameterType::FLOAT, "Seconds of audio to render")
+                  .addParameter("effects", ParameterType::INT, "Effect mask: 1=filter, 2=delay, 4=physical model", true, "0");
+    registry.registerFunction(std::move(voiceBenchmark));
+
+    // VOICE_BENCHMARK_COST - CPU cost breakdown of the last VOICE_BENCHMARK
+    CommandDefinition voiceBenchmarkCost("VOICE_BENCHMARK_COST",
+                                         "Get CPU microseconds per voice per audio second from the last VOICE_BENCHMARK",
+                                         "voice_benchmark_cost", "audio", false, ReturnType::FLOAT);
+    voiceBenchmarkCost.addParameter("kind", ParameterType::INT, "0=plain voice, 1=filter, 2=delay, 3=physical model");
+    registry.registerFunction(std::move(voiceBenchmarkCost));
 }
 
 // =============================================================================
@@ -1617,6 +1702,73 @@ void SuperTerminalCommandRegistry::registerUtilityCommands(CommandRegistry& regi
             .addParameter("blue", ParameterType::INT, "Blue component (0-255)")
             .addParameter("alpha", ParameterType::INT, "Alpha component (0-255)");
     registry.registerFunction(std::move(rgbaFunc));
+
+    // ASSET_PREFETCH - Start loading an asset or file in the background
+    CommandDefinition assetPrefetch("ASSET_PREFETCH",
+                                    "Prefetch a cart asset or file so a later load completes immediately",
+                                    "asset_prefetch", "utility");
+    assetPrefetch.addParameter("name", ParameterType::STRING, "Asset name or file path")
+                 .addParameter("priority", ParameterType::INT, "Higher values are fetched first", true, "0");
+    registry.registerCommand(std::move(assetPrefetch));
+
+    // ASSET_PREFETCH_PENDING - Prefetch requests not yet completed
+    CommandDefinition assetPrefetchPending("ASSET_PREFETCH_PENDING",
+                                           "Get number of prefetch requests still in progress",
+                                           "asset_prefetch_pending", "utility", false, ReturnType::INT);
+    registry.registerFunction(std::move(assetPrefetchPending));
+
+    // ASSET_PREFETCH_BYTES - Bytes of queued prefetch files not yet read
+    CommandDefinition assetPrefetchBytes("ASSET_PREFETCH_BYTES",
+                                         "Get number of bytes still to be read by pending prefetches",
+                                         "asset_prefetch_bytes", "utility", false, ReturnType::INT);
+    registry.registerFunction(std::move(assetPrefetchBytes));
+
+    // ASSET_SET_BUDGET - Cap resident bytes for one asset type (0 = unlimited)
+    CommandDefinition assetSetBudget("ASSET_SET_BUDGET",
+                                     "Set the resident memory budget for an asset type",
+                                     "asset_set_type_budget", "utility");
+    assetSetBudget.addParameter("type", ParameterType::INT, "Asset type (ASSET_SPRITE, ASSET_SOUND, ASSET_MUSIC, ASSET_DATA, ...)")
+                  .addParameter("bytes", ParameterType::INT, "Budget in bytes (0 = unlimited)");
+    registry.registerCommand(std::move(assetSetBudget));
+
+    // ASSET_PIN - Keep an asset resident regardless of its type budget
+    CommandDefinition assetPin("ASSET_PIN",
+                               "Pin a loaded asset so it is never evicted",
+                               "asset_pin", "utility");
+    assetPin.addParameter("asset_id", ParameterType::INT, "Asset ID from ASSET_LOAD");
+    registry.registerCommand(std::move(assetPin));
+
+    // ASSET_UNPIN - Allow a pinned asset to be evicted again
+    CommandDefinition assetUnpin("ASSET_UNPIN",
+                                 "Release a pin taken with ASSET_PIN",
+                                 "asset_unpin", "utility");
+    assetUnpin.addParameter("asset_id", ParameterType::INT, "Asset ID from ASSET_LOAD");
+    registry.registerCommand(std::move(assetUnpin));
+
+    // ASSET_TYPE_HITS / MISSES / EVICTIONS / BYTES - Per-type cache statistics
+    CommandDefinition assetTypeHits("ASSET_TYPE_HITS",
+                                    "Get number of loads of an asset type served from the resident set",
+                                    "asset_type_hits", "utility", false, ReturnType::INT);
+    assetTypeHits.addParameter("type", ParameterType::INT, "Asset type");
+    registry.registerFunction(std::move(assetTypeHits));
+
+    CommandDefinition assetTypeMisses("ASSET_TYPE_MISSES",
+                                      "Get number of loads of an asset type that went to the asset store",
+                                      "asset_type_misses", "utility", false, ReturnType::INT);
+    assetTypeMisses.addParameter("type", ParameterType::INT, "Asset type");
+    registry.registerFunction(std::move(assetTypeMisses));
+
+    CommandDefinition assetTypeEvictions("ASSET_TYPE_EVICTIONS",
+                                         "Get number of assets of a type evicted to stay within budget",
+                                         "asset_type_evictions", "utility", false, ReturnType::INT);
+    assetTypeEvictions.addParameter("type", ParameterType::INT, "Asset type");
+    registry.registerFunction(std::move(assetTypeEvictions));
+
+    CommandDefinition assetTypeBytes("ASSET_TYPE_BYTES",
+                                     "Get resident bytes for an asset type",
+                                     "asset_type_bytes", "utility", false, ReturnType::INT);
+    assetTypeBytes.addParameter("type", ParameterType::INT, "Asset type");
+    registry.registerFunction(std::move(assetTypeBytes));
 }
 
 // =============================================================================
@@ -1936,6 +2088,22 @@ void SuperTerminalCommandRegistry::registerSpriteFunctions(CommandRegistry& regi
     sprite_explode_mode.addParameter("sprite_id", ParameterType::INT, "Sprite ID")
                        .addParameter("mode", ParameterType::INT, "Explosion mode (1-6)");
     registry.registerFunction(std::move(sprite_explode_mode));
+
+    // SPRITE_EXPLODE_RANGE - Explode a contiguous range of sprites with one preset (returns count)
+    CommandDefinition sprite_explode_range("SPRITE_EXPLODE_RANGE",
+                                            "Explode sprites first..last using a preset mode, sharing the fragment budget",
+                                            "sprite_explode_range", "sprite", false, ReturnType::INT);
+    sprite_explode_range.addParameter("first_id", ParameterType::INT, "First sprite ID")
+                        .addParameter("last_id", ParameterType::INT, "Last sprite ID")
+                        .addParameter("mode", ParameterType::INT, "Explosion mode (1-6)");
+    registry.registerFunction(std::move(sprite_explode_range));
+
+    // SPRITE_EXPLODE_BUDGET - Cap the fragments one SPRITE_EXPLODE_RANGE call spawns in total
+    CommandDefinition sprite_explode_budget("SPRITE_EXPLODE_BUDGET",
+                                             "Set the fragment budget shared by the sprites of one SPRITE_EXPLODE_RANGE call (0 = unlimited; at least one fragment per sprite)",
+                                             "sprite_explode_set_budget", "sprite");
+    sprite_explode_budget.addParameter("fragments", ParameterType::INT, "Maximum fragments per call");
+    registry.registerCommand(std::move(sprite_explode_budget));
 }
 
 // =============================================================================
@@ -2457,6 +2625,143 @@ void SuperTerminalCommandRegistry::registerTilemapCommands(CommandRegistry& regi
     tilemapClear.addParameter("layer_id", ParameterType::INT, "Layer ID to clear");
     registry.registerCommand(std::move(tilemapClear));
 
+    // Bulk Region Editing
+    CommandDefinition tilemapSetRegion("TILEMAP_SET_REGION",
+                                      "Write a rectangle of tiles from an array or packed string",
+                                      "tilemap.setRegion", "tilemap");
+    tilemapSetRegion.addParameter("layer_id", ParameterType::INT, "Layer ID")
+                    .addParameter("x", ParameterType::INT, "Start X coordinate")
+                    .addParameter("y", ParameterType::INT, "Start Y coordinate")
+                    .addParameter("width", ParameterType::INT, "Region width in tiles")
+                    .addParameter("height", ParameterType::INT, "Region height in tiles")
+                    .addParameter("tiles", ParameterType::STRING, "Array of tile IDs (row-major) or packed string")
+                    .addParameter("start", ParameterType::INT, "First array index to read", true, "0");
+    registry.registerCommand(std::move(tilemapSetRegion));
+
+    CommandDefinition tilemapGetRegion("TILEMAP_GET_REGION",
+                                      "Read a rectangle of tiles into an array",
+                                      "tilemap.getRegion", "tilemap");
+    tilemapGetRegion.addParameter("layer_id", ParameterType::INT, "Layer ID")
+                    .addParameter("x", ParameterType::INT, "Start X coordinate")
+                    .addParameter("y", ParameterType::INT, "Start Y coordinate")
+                    .addParameter("width", ParameterType::INT, "Region width in tiles")
+                    .addParameter("height", ParameterType::INT, "Region height in tiles")
+                    .addParameter("array", ParameterType::STRING, "Array to receive tile IDs (row-major)")
+                    .addParameter("start", ParameterType::INT, "First array index to write", true, "0");
+    registry.registerCommand(std::move(tilemapGetRegion));
+
+    CommandDefinition tilemapGetRegionPacked("TILEMAP_GET_REGION_PACKED",
+                                            "Read a rectangle of tiles as a packed string (2 bytes per tile)",
+                                            "tilemap.getRegionPacked", "tilemap", false, ReturnType::STRING);
+    tilemapGetRegionPacked.addParameter("layer_id", ParameterType::INT, "Layer ID")
+                          .addParameter("x", ParameterType::INT, "Start X coordinate")
+                          .addParameter("y", ParameterType::INT, "Start Y coordinate")
+                          .addParameter("width", ParameterType::INT, "Region width in tiles")
+                          .addParameter("height", ParameterType::INT, "Region height in tiles");
+    registry.registerFunction(std::move(tilemapGetRegionPacked));
+
+    CommandDefinition tilemapCopyRegion("TILEMAP_COPY_REGION",
+                                       "Copy a rectangle of tiles to another position or layer",
+                                       "tilemap.copyRegion", "tilemap");
+    tilemapCopyRegion.addParameter("src_layer_id", ParameterType::INT, "Source layer ID")
+                     .addParameter("x", ParameterType::INT, "Source X coordinate")
+                     .addParameter("y", ParameterType::INT, "Source Y coordinate")
+                     .addParameter("width", ParameterType::INT, "Region width in tiles")
+                     .addParameter("height", ParameterType::INT, "Region height in tiles")
+                     .addParameter("dst_layer_id", ParameterType::INT, "Destination layer ID")
+                     .addParameter("dst_x", ParameterType::INT, "Destination X coordinate")
+                     .addParameter("dst_y", ParameterType::INT, "Destination Y coordinate");
+    registry.registerCommand(std::move(tilemapCopyRegion));
+
+    CommandDefinition tilemapSetRow("TILEMAP_SET_ROW",
+                                   "Write a row of tiles (for streaming scrolling worlds)",
+                                   "tilemap.setRow", "tilemap");
+    tilemapSetRow.addParameter("layer_id", ParameterType::INT, "Layer ID")
+                 .addParameter("x", ParameterType::INT, "Start X coordinate")
+                 .addParameter("y", ParameterType::INT, "Row Y coordinate")
+                 .addParameter("count", ParameterType::INT, "Number of tiles")
+                 .addParameter("tiles", ParameterType::STRING, "Array of tile IDs or packed string")
+                 .addParameter("start", ParameterType::INT, "First array index to read", true, "0");
+    registry.registerCommand(std::move(tilemapSetRow));
+
+    CommandDefinition tilemapSetColumn("TILEMAP_SET_COLUMN",
+                                      "Write a column of tiles (for streaming scrolling worlds)",
+                                      "tilemap.setColumn", "tilemap");
+    tilemapSetColumn.addParameter("layer_id", ParameterType::INT, "Layer ID")
+                    .addParameter("x", ParameterType::INT, "Column X coordinate")
+                    .addParameter("y", ParameterType::INT, "Start Y coordinate")
+                    .addParameter("count", ParameterType::INT, "Number of tiles")
+                    .addParameter("tiles", ParameterType::STRING, "Array of tile IDs or packed string")
+                    .addParameter("start", ParameterType::INT, "First array index to read", true, "0");
+    registry.registerCommand(std::move(tilemapSetColumn));
+
+    // Chunked Tilemaps - unbounded worlds generated around the camera
+    CommandDefinition chunkmapCreate("CHUNKMAP_CREATE",
+                                    "Create a chunked tilemap on a layer (one at a time); returns map ID",
+                                    "chunkmap_create", "tilemap", false, ReturnType::INT);
+    chunkmapCreate.addParameter("layer_id", ParameterType::INT, "Layer to display the map on")
+                  .addParameter("tile_width", ParameterType::INT, "Tile width in pixels")
+                  .addParameter("tile_height", ParameterType::INT, "Tile height in pixels")
+                  .addParameter("chunk_size", ParameterType::INT, "Chunk width/height in tiles", true, "32")
+                  .addParameter("radius", ParameterType::INT, "Chunks kept around the camera chunk", true, "1")
+                  .addParameter("generator", ParameterType::STRING, "SUB called as generator(map, chunk_x, chunk_y)", true, "\"\"");
+    registry.registerFunction(std::move(chunkmapCreate));
+
+    CommandDefinition chunkmapDestroy("CHUNKMAP_DESTROY",
+                                     "Destroy a chunked tilemap",
+                                     "chunkmap_destroy", "tilemap");
+    chunkmapDestroy.addParameter("map_id", ParameterType::INT, "Chunk map ID");
+    registry.registerCommand(std::move(chunkmapDestroy));
+
+    CommandDefinition chunkmapSetCamera("CHUNKMAP_SET_CAMERA",
+                                       "Move the shared tilemap camera in world pixels, loading and dropping chunks as needed",
+                                       "chunkmap_set_camera", "tilemap");
+    chunkmapSetCamera.addParameter("map_id", ParameterType::INT, "Chunk map ID")
+                     .addParameter("x", ParameterType::FLOAT, "World X position")
+                     .addParameter("y", ParameterType::FLOAT, "World Y position");
+    registry.registerCommand(std::move(chunkmapSetCamera));
+
+    CommandDefinition chunkmapSetTile("CHUNKMAP_SET_TILE",
+                                     "Set a tile at world tile coordinates",
+                                     "chunkmap_set_tile", "tilemap");
+    chunkmapSetTile.addParameter("map_id", ParameterType::INT, "Chunk map ID")
+                   .addParameter("x", ParameterType::INT, "World tile X")
+                   .addParameter("y", ParameterType::INT, "World tile Y")
+                   .addParameter("tile_id", ParameterType::INT, "Tile ID to place");
+    registry.registerCommand(std::move(chunkmapSetTile));
+
+    CommandDefinition chunkmapGetTile("CHUNKMAP_GET_TILE",
+                                     "Get the tile at world tile coordinates (0 if not loaded)",
+                                     "chunkmap_get_tile", "tilemap", false, ReturnType::INT);
+    chunkmapGetTile.addParameter("map_id", ParameterType::INT, "Chunk map ID")
+                   .addParameter("x", ParameterType::INT, "World tile X")
+                   .addParameter("y", ParameterType::INT, "World tile Y");
+    registry.registerFunction(std::move(chunkmapGetTile));
+
+    CommandDefinition chunkmapSetRegion("CHUNKMAP_SET_REGION",
+                                       "Write a rectangle of tiles at world tile coordinates",
+                                       "chunkmap_set_region", "tilemap");
+    chunkmapSetRegion.addParameter("map_id", ParameterType::INT, "Chunk map ID")
+                     .addParameter("x", ParameterType::INT, "World tile X")
+                     .addParameter("y", ParameterType::INT, "World tile Y")
+                     .addParameter("width", ParameterType::INT, "Region width in tiles")
+                     .addParameter("height", ParameterType::INT, "Region height in tiles")
+                     .addParameter("tiles", ParameterType::STRING, "Array of tile IDs (row-major) or packed string")
+                     .addParameter("start", ParameterType::INT, "First array index to read", true, "0");
+    registry.registerCommand(std::move(chunkmapSetRegion));
+
+    CommandDefinition chunkmapResident("CHUNKMAP_RESIDENT",
+                                      "Get number of chunks currently in memory",
+                                      "chunkmap_get_resident", "tilemap", false, ReturnType::INT);
+    chunkmapResident.addParameter("map_id", ParameterType::INT, "Chunk map ID");
+    registry.registerFunction(std::move(chunkmapResident));
+
+    CommandDefinition chunkmapPending("CHUNKMAP_PENDING",
+                                     "Get number of chunks waiting to be generated",
+                                     "chunkmap_get_pending", "tilemap", false, ReturnType::INT);
+    chunkmapPending.addParameter("map_id", ParameterType::INT, "Chunk map ID");
+    registry.registerFunction(std::move(chunkmapPending));
+
     // Camera Control
     CommandDefinition tilemapSetCamera("TILEMAP_SET_CAMERA",
                                       "Set camera position",
@@ -2557,6 +2862,19 @@ void SuperTerminalCommandRegistry::registerSystemFunctions(CommandRegistry& regi
            .setReturnType(ReturnType::INT);
     registry.registerFunction(std::move(randFunc));
 
+    // RANDSEED - Seed this script's RND/RAND generator for reproducible runs
+    CommandDefinition randSeed("RANDSEED", "Seed the random number generator used by RND and RAND", "st_rand_seed", "system");
+    randSeed.addParameter("seed", ParameterType::INT, "Seed value");
+    registry.registerCommand(std::move(randSeed));
+
+    // RANDFILL - Fill an array with random values in one call
+    CommandDefinition randFill("RANDFILL", "Fill array elements start..start+count-1 with RAND(max), or RND values when max <= 0", "st_rand_fill", "system");
+    randFill.addParameter("array", ParameterType::STRING, "Array to fill")
+            .addParameter("count", ParameterType::INT, "Number of elements to write")
+            .addParameter("max", ParameterType::INT, "Maximum integer value (inclusive), or 0 for RND floats")
+            .addParameter("start", ParameterType::INT, "First index to write", true, "0");
+    registry.registerCommand(std::move(randFill));
+
     // DisplayText functions that return values
     CommandDefinition displayTextCount("DISPLAYTEXT_COUNT", "Get number of displayed text items", "text_get_item_count", "text");
     displayTextCount.setReturnType(ReturnType::INT);
@@ -2814,6 +3132,18 @@ void SuperTerminalCommandRegistry::registerSoundBankFunctions(CommandRegistry& r
                                  "sound_get_memory_usage", "audio", false, ReturnType::INT);
     registry.registerFunction(std::move(soundMemory));
 
+    // SOUND_CACHE_HITS - SOUND_CREATE_* calls served from the synthesis cache
+    CommandDefinition soundCacheHits("SOUND_CACHE_HITS",
+                                    "Get number of sound creations reused from the synthesis cache",
+                                    "sound_cache_get_hits", "audio", false, ReturnType::INT);
+    registry.registerFunction(std::move(soundCacheHits));
+
+    // SOUND_CACHE_MISSES - SOUND_CREATE_* calls that had to synthesize
+    CommandDefinition soundCacheMisses("SOUND_CACHE_MISSES",
+                                      "Get number of sound creations that synthesized a new buffer",
+                                      "sound_cache_get_misses", "audio", false, ReturnType::INT);
+    registry.registerFunction(std::move(soundCacheMisses));
+
     // -------------------------------------------------------------------------
     // Phase 3: Custom Synthesis
     // -------------------------------------------------------------------------
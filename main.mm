@@ -21,6 +21,10 @@
 #import "BaseRunner.h"
 #import "Application/FBRunner3App.h"
 #import "Application/CommandRegistryInit.h"
+#import "Application/IdentifierClassifier.h"
+#import "Application/HighlightCache.h"
+#import "Application/ParallelLexer.h"
+#import "Application/CompileCache.h"
 #import "HelpViewController.h"
 #include "Debug/Logger.h"
 #include <iostream>
@@ -53,6 +57,7 @@
 #include "command_registry_core.h"
 #include "command_registry_superterminal.h"
 #include "../Framework/Cart/CartManager.h"
+#include "MappedFile.h"
 
 extern "C" {
 #include <lua.h>
@@ -85,6 +90,7 @@ static BaseRunner* g_runnerInstance = nullptr;
     lua_State* _luaState;
     std::thread _scriptThread;
     FasterBASIC::DataPreprocessorResult dataResult;
+    FBRunner3::CompileCache _compileCache;
     std::string _currentScriptContent;
     std::mutex _luaStateMutex;
     std::mutex _scriptThreadMutex;  // Protects _scriptThread operations
@@ -167,9 +173,11 @@ static BaseRunner* g_runnerInstance = nullptr;
     int _lastLineNumber;
     int _suggestedNextLine;
 
-    // Syntax highlighting - user-defined constants cache
-    std::unordered_set<std::string> _userDefinedConstants;
-    std::vector<std::string> _predefinedConstantNames;  // Cache of predefined constant names
+    // Syntax highlighting - CONSTANT names declared in the edited program,
+    // tracked per line, and colours cached per distinct line text
+    FBRunner3::Syntax::UserConstantTracker _userConstants;
+    FBRunner3::Syntax::LineColorCache _lineColorCache;
+    bool _userConstantsSynced;   // Cleared by editorTextDidChange
 
     // Cart system - use BaseRunner's self.cartManager (inherited)
 }
@@ -353,6 +361,7 @@ static BaseRunner* g_runnerInstance = nullptr;
 
         if (self.textEditor) {
             self.textEditor->loadText(welcome);
+            [self editorTextDidChange];
             self.textEditor->setFilename("untitled");
 
             // CRITICAL: Render the initial content to TextGrid immediately
@@ -401,6 +410,8 @@ static BaseRunner* g_runnerInstance = nullptr;
                 luaL_error(L, "Script stopped by user");
                 return 0;
             }
+            FBTBindings::flushVoiceParameters();
+            FBTBindings::pumpAssetPrefetch();
             [app waitForNextFrame];
         }
         return 0;
@@ -1459,6 +1470,7 @@ extern "C" {
     if (self.textEditor && !result.programSource.empty()) {
         LOG_INFO("Calling textEditor->loadText()...");
         self.textEditor->loadText(result.programSource);
+        [self editorTextDidChange];
         LOG_INFO("Calling textEditor->setFilename()...");
         self.textEditor->setFilename([[path lastPathComponent] UTF8String]);
         LOG_INFO("Calling textEditor->render()...");
@@ -1540,6 +1552,7 @@ extern "C" {
     // Load program into editor (will be empty)
     if (self.textEditor && !result.programSource.empty()) {
         self.textEditor->loadText(result.programSource);
+        [self editorTextDidChange];
         self.textEditor->setFilename([[path lastPathComponent] UTF8String]);
         self.textEditor->render();
     }